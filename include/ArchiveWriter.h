@@ -0,0 +1,25 @@
+#pragma once
+
+#include <filesystem>
+#include <ostream>
+#include <string_view>
+
+#include "File.h"
+
+// Streams generated files into a single ustar archive. Every entry is written as soon as it is added, so only one
+// file is ever held in memory. Timestamps and ownership are fixed to keep the archive reproducible.
+class ArchiveWriter
+{
+public:
+    explicit ArchiveWriter(std::ostream& out);
+
+    bool add(const std::filesystem::path& relativePath, std::string_view content);
+    bool add(const File& file, const std::filesystem::path& basePath);
+    bool finish();
+
+private:
+    bool writeHeader(const std::string& path, size_t size);
+
+    std::ostream& m_out;
+    bool m_finished = false;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <ostream>
+#include <string_view>
+
+// Collects the time spent in the phases of a run. Every mark closes the phase that started with the previous mark
+// (or with static initialization for the first one); phases with the same name are summed up.
+class StartupProfiler
+{
+public:
+    static void mark(std::string_view phase);
+    static void report(std::ostream& out);
+};
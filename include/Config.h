@@ -4,11 +4,13 @@
 #include <filesystem>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 class Config
 {
 public:
-    bool parseAndLoad(int argc, char** argv);
+    // relative paths on the command line are relative to workingDirectory, or to the current path if it is empty
+    bool parseAndLoad(int argc, char** argv, const std::filesystem::path& workingDirectory = {});
 
     const std::filesystem::path& projectPath() const;
     std::filesystem::path modelsPath() const;
@@ -18,21 +20,58 @@ public:
     const std::string& headerFileExtention() const;
     const std::string& sourceFileExtention() const;
     bool overwriteExistingFiles() const;
+    std::filesystem::path archivePath() const;
+    std::filesystem::path serverSocket() const;
+    std::filesystem::path clientSocket() const;
+    std::filesystem::path manifestPath() const;
+    bool profileStartup() const;
+    // hash of everything that changes the generated files: all settings, the output folders and the templates
+    std::string fingerprint() const;
 
     const std::string& memberPrefix() const;
     const std::string& indent() const;
     bool noMemberPrefixForStructs() const;
     bool concatenateNamespaces() const;
+    bool forwardDeclarations() const;
+    bool minimizeIncludes() const;
+    bool includeReport() const;
+    bool optimizeMemberLayout() const;
+    bool groupByVisibility() const;
+    bool specialMembers() const;
+    bool finalClasses() const;
+    bool memberReflection() const;
+    bool equalityAndHash() const;
+    bool enumReflection() const;
+    const std::string& enumUnderlyingType() const;
+    bool variantDispatch() const;
+    bool compactVariants() const;
+    bool wireFormat() const;
+    std::filesystem::path classHeaderTemplate() const;
+    std::filesystem::path enumHeaderTemplate() const;
+    std::filesystem::path variantHeaderTemplate() const;
 
     const std::unordered_map<std::string, std::string>& containerByCardinalityComposition() const;
     const std::unordered_map<std::string, std::string>& containerByCardinalityAggregation() const;
+    const std::string& boundedContainer() const;
+    size_t maxInlineCapacity() const;
+    const std::string& aggregationPolicy() const;
+    const std::unordered_map<std::string, std::string>& aggregationPolicyByStereotype() const;
+    const std::unordered_set<std::string>& specialMembersStereotypes() const;
+    const std::unordered_set<std::string>& nonCopyableTypes() const;
+    const std::unordered_set<std::string>& nonMovableTypes() const;
+    const std::unordered_set<std::string>& throwingMoveTypes() const;
+    const std::unordered_set<std::string>& triviallyCopyableTypes() const;
+    const std::unordered_set<std::string>& wireScalarTypes() const;
 
     const std::unordered_map<std::string, std::string>& typeToIncludeMap() const;
     const std::unordered_map<std::string, std::string>& umlToCppTypeMap() const;
+    const std::unordered_map<std::string, std::array<size_t, 2>>& typeLayouts() const;
 
 private:
     void readConfigFrom(std::filesystem::path configFilePath);
     void writeConfigTo(std::filesystem::path configFilePath);
+    // the settings as written to the config file
+    std::string settings(int indent) const;
 
 private:
     // project and file generation settings
@@ -44,17 +83,110 @@ private:
     std::string m_headerFileExtention   = "h";
     std::string m_sourceFileExtention   = "cpp";
     bool m_overwriteExistingFiles       = false;
+    std::string m_archivePath;
+    std::string m_serverSocket;
+    std::string m_clientSocket;
+    bool m_profileStartup = false;
 
     // code generation settings
     std::string m_memberPrefix    = "m_";
     std::string m_indent          = "    ";
     bool m_memberPrefixForStructs = false;
     bool m_concatenateNamespaces  = false;
+    bool m_forwardDeclarations    = false;
+    bool m_minimizeIncludes       = false;
+    bool m_includeReport          = false;
+    bool m_optimizeMemberLayout   = false;
+    bool m_groupByVisibility      = false;
+    bool m_specialMembers         = false;
+    bool m_finalClasses           = false;
+    bool m_memberReflection       = false;
+    bool m_equalityAndHash        = false;
+    bool m_enumReflection         = false;
+    // underlying type of generated enums: empty for the compiler's default, "auto" for the smallest fitting one
+    std::string m_enumUnderlyingType;
+    bool m_variantDispatch = false;
+    bool m_compactVariants = false;
+    bool m_wireFormat      = false;
+
+    // layout templates for generated headers, relative to the config folder (empty for the built-in layout)
+    std::string m_classHeaderTemplate;
+    std::string m_enumHeaderTemplate;
+    std::string m_variantHeaderTemplate;
 
     // translation settings
     std::unordered_map<std::string, std::string> m_containerByCardinalityComposition = {{"0..*", "std::vector<{}>"}};
     std::unordered_map<std::string, std::string> m_containerByCardinalityAggregation = {
         {"", "std::shared_ptr<{}>"}, {"1", "std::shared_ptr<{}>"}, {"0..*", "std::vector<std::shared_ptr<{}>>"}};
+    // compositions with another cardinality are mapped by its bounds, bounded ones up to this capacity stay inline if
+    // a container is configured for them
+    std::string m_boundedContainer;
+    size_t m_maxInlineCapacity = 16;
+    // how aggregations refer to their objects: shared, observer, weak, intrusive or pool
+    std::string m_aggregationPolicy = "shared";
+    std::unordered_map<std::string, std::string> m_aggregationPolicyByStereotype;
+
+    // defaulted special members for all classes (specialMembers) or classes with one of these stereotypes, deleted or
+    // without noexcept where a member or base type requires it
+    std::unordered_set<std::string> m_specialMembersStereotypes = {"RuleOfFive"};
+
+    std::unordered_set<std::string> m_nonCopyableTypes = {
+        "std::unique_ptr", "std::thread", "std::jthread", "std::promise", "std::future", "std::packaged_task"};
+
+    std::unordered_set<std::string> m_nonMovableTypes = {"std::mutex",
+                                                         "std::recursive_mutex",
+                                                         "std::shared_mutex",
+                                                         "std::atomic",
+                                                         "std::condition_variable",
+                                                         "std::once_flag"};
+
+    // standard containers whose move constructor isn't noexcept in every standard library
+    std::unordered_set<std::string> m_throwingMoveTypes = {"std::deque",
+                                                           "std::list",
+                                                           "std::map",
+                                                           "std::multimap",
+                                                           "std::set",
+                                                           "std::multiset",
+                                                           "std::unordered_map",
+                                                           "std::unordered_set"};
+
+    // types a compact variant may contain besides pointers, model enums and trivially copyable model classes
+    std::unordered_set<std::string> m_triviallyCopyableTypes = {"bool",
+                                                                "char",
+                                                                "short",
+                                                                "int",
+                                                                "uint",
+                                                                "unsigned int",
+                                                                "long",
+                                                                "float",
+                                                                "double",
+                                                                "size_t",
+                                                                "std::size_t",
+                                                                "std::byte",
+                                                                "std::int8_t",
+                                                                "std::uint8_t",
+                                                                "std::int16_t",
+                                                                "std::uint16_t",
+                                                                "std::int32_t",
+                                                                "std::uint32_t",
+                                                                "std::int64_t",
+                                                                "std::uint64_t",
+                                                                "std::string_view"};
+
+    // types a struct with a wire format may contain as fixed size values besides model enums, written in their width,
+    // so only types whose width doesn't depend on the platform
+    std::unordered_set<std::string> m_wireScalarTypes = {"bool",
+                                                         "float",
+                                                         "double",
+                                                         "std::byte",
+                                                         "std::int8_t",
+                                                         "std::uint8_t",
+                                                         "std::int16_t",
+                                                         "std::uint16_t",
+                                                         "std::int32_t",
+                                                         "std::uint32_t",
+                                                         "std::int64_t",
+                                                         "std::uint64_t"};
 
     std::unordered_map<std::string, std::string> m_typeToIncludeMap = {{"std::string", "string"},
                                                                        {"std::vector", "vector"},
@@ -62,6 +194,13 @@ private:
                                                                        {"std::list", "list"},
                                                                        {"std::unordered_map", "unordered_map"},
                                                                        {"std::shared_ptr", "memory"},
+                                                                       {"std::weak_ptr", "memory"},
+                                                                       {"std::optional", "optional"},
+                                                                       {"std::array", "array"},
+                                                                       {"boost::container::static_vector",
+                                                                        "boost/container/static_vector.hpp"},
+                                                                       {"boost::container::small_vector",
+                                                                        "boost/container/small_vector.hpp"},
                                                                        {"std::filesystem::path", "filesystem"}};
 
     std::unordered_map<std::string, std::string> m_umlToCppTypeMap = {{"string", "std::string"},
@@ -70,4 +209,39 @@ private:
                                                                       {"list", "std::list"},
                                                                       {"umap", "std::unordered_map"},
                                                                       {"path", "std::filesystem::path"}};
+
+    // size and alignment of types on a typical 64 bit platform, used to estimate the layout of generated classes
+    std::unordered_map<std::string, std::array<size_t, 2>> m_typeLayouts = {{"bool", {1, 1}},
+                                                                           {"char", {1, 1}},
+                                                                           {"short", {2, 2}},
+                                                                           {"int", {4, 4}},
+                                                                           {"uint", {4, 4}},
+                                                                           {"unsigned int", {4, 4}},
+                                                                           {"long", {8, 8}},
+                                                                           {"float", {4, 4}},
+                                                                           {"double", {8, 8}},
+                                                                           {"size_t", {8, 8}},
+                                                                           {"std::int8_t", {1, 1}},
+                                                                           {"std::uint8_t", {1, 1}},
+                                                                           {"std::int16_t", {2, 2}},
+                                                                           {"std::uint16_t", {2, 2}},
+                                                                           {"std::int32_t", {4, 4}},
+                                                                           {"std::uint32_t", {4, 4}},
+                                                                           {"std::int64_t", {8, 8}},
+                                                                           {"std::uint64_t", {8, 8}},
+                                                                           {"std::string", {32, 8}},
+                                                                           {"std::string_view", {16, 8}},
+                                                                           {"std::vector", {24, 8}},
+                                                                           {"std::list", {24, 8}},
+                                                                           {"std::map", {48, 8}},
+                                                                           {"std::set", {48, 8}},
+                                                                           {"std::unordered_map", {56, 8}},
+                                                                           {"std::unordered_set", {56, 8}},
+                                                                           {"std::unique_ptr", {8, 8}},
+                                                                           {"std::shared_ptr", {16, 8}},
+                                                                           {"std::weak_ptr", {16, 8}},
+                                                                           {"IntrusivePtr", {8, 8}},
+                                                                           {"Handle", {8, 4}},
+                                                                           {"std::function", {32, 8}},
+                                                                           {"std::filesystem::path", {40, 8}}};
 };
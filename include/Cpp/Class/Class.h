@@ -1,6 +1,7 @@
 #pragma once
 
 #include <list>
+#include <map>
 #include <set>
 #include <string>
 #include <variant>
@@ -34,6 +35,8 @@ struct Method
     bool isConst    = false;
     bool isStatic   = false;
     std::vector<Parameter> parameters;
+    // overrides an abstract method of a base in a class nothing derives from
+    bool isFinal = false;
 };
 
 struct VisibilityKeyword
@@ -48,17 +51,37 @@ struct Separator
 
 using ClassElement = std::variant<std::string, Variable, Method, VisibilityKeyword, Separator>;
 
+// a model class a header declares instead of including its header
+struct ForwardDeclaration
+{
+    std::string name; // fully qualified
+    bool isStruct = false;
+    auto operator<=>(const ForwardDeclaration&) const = default;
+};
+
 struct Class
 {
     std::string name;
     std::string comment;
+    std::string stereotype;
     bool isInterface = false;
     bool isStruct    = false;
+    bool isFinal     = false;
+    // has a defaulted operator== and a std::hash specialization
+    bool isHashable = false;
     std::list<std::string> namespaces;
     std::vector<std::string> inherits;
     std::set<std::string> localIncludes;
     std::set<std::string> externalIncludes;
     std::vector<ClassElement> body;
+    // model classes the header only declares, their headers are included by the source
+    std::set<ForwardDeclaration> forwardDeclarations;
+    std::set<std::string> sourceIncludes;
+    // local includes a forward declaration could replace, mapped to the declaration
+    std::map<std::string, ForwardDeclaration> declarableIncludes;
+    // structs written in the wire format, with the wire headers of the structs they contain
+    bool hasWireFormat = false;
+    std::set<std::string> wireIncludes;
 };
 
 } // namespace Cpp::Class
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <filesystem>
+#include <set>
+
 #include "Class.h"
 #include "File.h"
 #include "Generator.h"
@@ -7,7 +10,9 @@
 #include "PlantUml/SyntaxNode.h"
 #include "PostProcessor.h"
 #include "SourceGenerator.h"
+#include "SupportHeaders.h"
 #include "Translator.h"
+#include "WireFormat.h"
 
 namespace Cpp {
 namespace Class {
@@ -15,15 +20,33 @@ namespace Class {
 class ClassGenerator : public Generator
 {
 public:
-    explicit ClassGenerator(std::shared_ptr<Config> config);
+    // maxThreads limits the threads rendering the classes of a diagram, 0 uses all hardware threads
+    explicit ClassGenerator(std::shared_ptr<Config> config,
+                            std::shared_ptr<Common::TypeRenderer> typeRenderer =
+                                std::make_shared<Common::TypeRenderer>(),
+                            size_t maxThreads = 0);
+    void prepare(const std::vector<const PlantUml::SyntaxNode*>& models) override;
     std::vector<File> generate(PlantUml::SyntaxNode root) override;
 
 private:
+    // renders one class, called concurrently for different classes
+    void render(const Class& c, File& header, File& source);
+    // the wire format and hashes need to know which types are enums
+    bool needsEnums() const;
+
     std::shared_ptr<Config> m_config;
+    size_t m_maxThreads;
 
     PostProcessor m_postProcessor;
     HeaderGenerator m_headerGenerator;
     SourceGenerator m_sourceGenerator;
+    SupportHeaders m_supportHeaders;
+    WireFormat m_wireFormat;
+
+    // support headers already generated for another model of the project
+    std::set<std::filesystem::path> m_generatedSupportHeaders;
+    // the types of the project with a struct-of-arrays companion
+    Common::ModelIndex<bool> m_companions;
 };
 
 } // namespace Class
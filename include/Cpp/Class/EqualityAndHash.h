@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "Config.h"
+
+#include "Cpp/Class/Class.h"
+#include "Cpp/Common/ModelIndex.h"
+#include "Cpp/Enum/Enum.h"
+
+namespace Cpp::Class {
+
+// Declares a defaulted operator== in structs and marks them for a std::hash specialization that combines the hashes of
+// their non-static data members, so they can be keys of unordered containers. Structs with bases, abstract methods or
+// reference members are left alone, the defaulted operator wouldn't compare them as values. Only structs whose members
+// all have a hash get the specialization: builtin types, enums, std types with a std::hash, containers, pairs and
+// tuples of such types and structs that have one themselves, those of other models as index found them.
+class EqualityAndHash
+{
+public:
+    explicit EqualityAndHash(std::shared_ptr<Config> config);
+    // judges the structs of all models of the project
+    void index(const std::vector<Class>& classes, const std::vector<Enum::Enum>& enums);
+    void add(std::vector<Class>& classes, const std::vector<Enum::Enum>& enums);
+
+private:
+    // helper methods
+    void indexTypes(const std::vector<Class>& classes, const std::vector<Enum::Enum>& enums);
+    bool hashable(const std::vector<Class>& classes, size_t index);
+    bool hashable(const std::vector<Class>& classes, const Class& scope, const Common::Type& type);
+
+    std::shared_ptr<Config> m_config;
+
+    Common::ModelIndex<size_t> m_classIndex;
+    Common::ModelIndex<bool> m_enums;
+    std::vector<Common::VisitState> m_states;
+    std::vector<bool> m_hashable;
+
+    // whether the structs and enums of the project have a hash
+    Common::ModelIndex<bool> m_project;
+};
+
+} // namespace Cpp::Class
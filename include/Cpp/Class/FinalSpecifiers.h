@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "Config.h"
+
+#include "Cpp/Class/Class.h"
+#include "Cpp/Common/ModelIndex.h"
+
+namespace Cpp::Class {
+
+// Declares the classes final that derive from a modeled class while no modeled class derives from them, together
+// with their methods overriding an abstract method of a base, so calls through the interfaces can be devirtualized.
+// A class in one diagram may be the base of a class in another, so the hierarchy of all classes of the project is
+// indexed once and add only looks up what it needs of the other models.
+class FinalSpecifiers
+{
+public:
+    explicit FinalSpecifiers(std::shared_ptr<Config> config);
+    // the classes of all models of the project
+    void index(const std::vector<Class>& classes);
+    void add(std::vector<Class>& classes);
+
+private:
+    struct Hierarchy
+    {
+        bool derived = false;                // a class of the project derives from it
+        std::vector<Method> abstractMethods; // of the class and all its bases
+    };
+
+    // helper methods
+    void indexClasses(const std::vector<Class>& classes);
+    std::vector<bool> derivedClasses(const std::vector<Class>& classes) const;
+    void collectAbstractMethods(const std::vector<Class>& classes,
+                                size_t index,
+                                std::vector<bool>& visited,
+                                std::vector<const Method*>& methods) const;
+
+    std::shared_ptr<Config> m_config;
+
+    Common::ModelIndex<size_t> m_classIndex;
+    Common::ModelIndex<Hierarchy> m_project;
+};
+
+} // namespace Cpp::Class
@@ -2,34 +2,44 @@
 
 #include <memory>
 #include <set>
+#include <string_view>
 
 #include "Class.h"
 #include "Config.h"
+#include "Cpp/Common/CodeEmitter.h"
 #include "Cpp/Common/CodeGeneratorUtils.h"
+#include "Cpp/Common/CodeTemplate.h"
+#include "Cpp/Common/TypeRenderer.h"
 
 namespace Cpp::Class {
 
+// Renders class headers. generate() keeps no state between calls and may be called from several threads at once.
 class HeaderGenerator
 {
 public:
-    explicit HeaderGenerator(std::shared_ptr<Config> config);
+    explicit HeaderGenerator(std::shared_ptr<Config> config,
+                             std::shared_ptr<Common::TypeRenderer> typeRenderer =
+                                 std::make_shared<Common::TypeRenderer>());
 
     std::string generate(const Class& in);
 
 private:
-    static std::string generateIncludes(const Class& in);
-
-    std::string toString(const std::string& s);
-    std::string toString(const Variable& var);
-    std::string toString(const Method& m);
-    std::string toString(const VisibilityKeyword& s);
-    std::string toString(const Separator& s);
-
-    std::string typeToString(const Common::Type& t);
+    static void generateIncludes(Common::CodeEmitter& out, const Class& in);
+    void generateForwardDeclarations(Common::CodeEmitter& out, const Class& in);
+    static void generateDefinition(Common::CodeEmitter& out, const Class& in);
+    void generateBody(Common::CodeEmitter& out, const Class& in);
+    void generateHash(Common::CodeEmitter& out, const Class& in);
+
+    void emit(Common::CodeEmitter& out, const std::string& s);
+    void emit(Common::CodeEmitter& out, const Variable& var, std::string_view variablePrefix);
+    void emit(Common::CodeEmitter& out, const Method& m);
+    void emit(Common::CodeEmitter& out, const VisibilityKeyword& s);
+    void emit(Common::CodeEmitter& out, const Separator& s);
 
     std::shared_ptr<Config> m_config;
-    std::string m_variablePrefix;
     Common::CodeGeneratorUtils m_genUtils;
+    std::shared_ptr<Common::TypeRenderer> m_typeRenderer;
+    Common::CodeTemplate m_template;
 };
 
 } // namespace Cpp::Class
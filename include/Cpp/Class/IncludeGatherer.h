@@ -2,10 +2,13 @@
 
 #include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "Config.h"
 
 #include "Cpp/Class/Class.h"
+#include "Cpp/Common/ModelIndex.h"
 
 namespace Cpp::Class {
 
@@ -13,13 +16,22 @@ class IncludeGatherer
 {
 public:
     explicit IncludeGatherer(std::shared_ptr<Config> config);
+    // the model classes, only these are declared instead of included
+    void index(const std::vector<Class>& classes);
     void gather(Class& c);
 
 private:
     // helper methods
-    std::set<std::string> decomposeType(const Common::Type& type);
+    static void collectTypes(const Common::Type& type,
+                             bool declarationSuffices,
+                             std::set<std::string>& completeTypes,
+                             std::set<std::string>& declaredTypes);
+    void addInclude(Class& c, const std::string& type);
+    static std::string includePath(const std::string& type);
 
     std::shared_ptr<Config> m_config;
+
+    Common::ModelIndex<ForwardDeclaration> m_declarations;
 };
 
 } // namespace Cpp::Class
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Config.h"
+
+#include "Cpp/Class/Class.h"
+#include "Cpp/Common/ModelIndex.h"
+
+namespace Cpp::Class {
+
+// Looks at the includes between the headers of all classes of a project at once. Include cycles are broken with
+// forward declarations where the including header doesn't need the complete type, includes that are also reached
+// through another include are dropped (minimizeIncludes) and the fan-in and fan-out of every header can be printed
+// (includeReport). The graph of the whole project is processed once by index, apply then changes the includes of
+// the classes of one model the same way.
+class IncludeGraph
+{
+public:
+    explicit IncludeGraph(std::shared_ptr<Config> config);
+    void process(std::vector<Class>& classes);
+    // processes the classes of all models of the project and remembers what changed for each of them
+    void index(std::vector<Class>& classes);
+    void apply(std::vector<Class>& classes) const;
+    // prints the fan-in and fan-out of the headers of the classes process was last called with
+    void report(const std::vector<Class>& classes) const;
+
+private:
+    struct Edge
+    {
+        size_t target;
+        std::string include;
+    };
+
+    struct Changes
+    {
+        std::set<std::string> declared; // includes replaced by a forward declaration
+        std::set<std::string> dropped;  // includes reached through another include
+    };
+
+    using Bitset = std::vector<std::uint64_t>;
+
+    // helper methods
+    void build(const std::vector<Class>& classes);
+    void findComponents();
+    void breakCycles(std::vector<Class>& classes);
+    void reduce(std::vector<Class>& classes);
+    std::vector<Bitset> reachability() const;
+
+    std::shared_ptr<Config> m_config;
+
+    std::vector<std::string> m_headers;           // per class
+    std::vector<std::vector<Edge>> m_edges;       // per class, the includes of other model headers
+    std::vector<std::vector<size_t>> m_components; // strongly connected components in reverse topological order
+    std::vector<size_t> m_componentOf;            // per class, the index of its component
+    std::vector<Changes> m_changes;               // per class
+
+    Common::ModelIndex<Changes> m_projectChanges;
+};
+
+} // namespace Cpp::Class
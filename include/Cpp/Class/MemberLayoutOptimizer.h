@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Config.h"
+
+#include "Cpp/Class/Class.h"
+#include "Cpp/Common/ModelIndex.h"
+#include "Cpp/Common/TypeLayout.h"
+
+namespace Cpp::Class {
+
+// Reorders the data members within each access section by decreasing alignment and size to minimize padding, and
+// adds a comment with the estimated sizeof before and after. Model types used by value are laid out first, so their
+// estimated size is known when they are members of other classes, the layouts of the classes of other models come
+// from index.
+class MemberLayoutOptimizer
+{
+public:
+    explicit MemberLayoutOptimizer(std::shared_ptr<Config> config);
+    // optimizes the classes of all models of the project and remembers their layouts
+    void index(std::vector<Class>& classes);
+    void optimize(std::vector<Class>& classes);
+
+private:
+    // helper methods
+    std::optional<Common::Layout> optimize(std::vector<Class>& classes, size_t index);
+
+    std::shared_ptr<Config> m_config;
+    Common::TypeLayout m_typeLayout;
+
+    Common::ModelIndex<size_t> m_classIndex;
+    std::vector<Common::VisitState> m_states;
+    std::vector<std::optional<Common::Layout>> m_layouts;
+
+    Common::ModelIndex<std::optional<Common::Layout>> m_projectLayouts;
+};
+
+} // namespace Cpp::Class
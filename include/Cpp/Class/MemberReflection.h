@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+
+#include "Config.h"
+
+#include "Cpp/Class/Class.h"
+
+namespace Cpp::Class {
+
+// Adds a public static constexpr function to classes that returns a tuple of the names and member pointers of their
+// non-static data members in declaration order, so generic code like serializers or hashers can iterate the members
+// at compile time. It has to run last, after the members got their final order.
+class MemberReflection
+{
+public:
+    explicit MemberReflection(std::shared_ptr<Config> config);
+    void add(Class& c) const;
+
+private:
+    std::shared_ptr<Config> m_config;
+};
+
+} // namespace Cpp::Class
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+
 #include "Class.h"
+#include "Config.h"
 
 namespace Cpp {
 namespace Class {
@@ -8,7 +11,15 @@ namespace Class {
 class MemberSorter
 {
 public:
+    explicit MemberSorter(std::shared_ptr<Config> config);
     void sort(Class& c);
+
+private:
+    // helper methods
+    void addVisibilityKeywords(Class& c);
+    void groupByVisibility(Class& c);
+
+    std::shared_ptr<Config> m_config;
 };
 
 } // namespace Class
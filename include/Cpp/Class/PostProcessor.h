@@ -4,8 +4,16 @@
 #include <set>
 
 #include "Cpp/Class/Class.h"
+#include "Cpp/Class/EqualityAndHash.h"
+#include "Cpp/Class/FinalSpecifiers.h"
 #include "Cpp/Class/IncludeGatherer.h"
+#include "Cpp/Class/IncludeGraph.h"
+#include "Cpp/Class/MemberLayoutOptimizer.h"
+#include "Cpp/Class/MemberReflection.h"
 #include "Cpp/Class/MemberSorter.h"
+#include "Cpp/Class/SpecialMembers.h"
+#include "Cpp/Class/StructOfArrays.h"
+#include "Cpp/Enum/Enum.h"
 
 namespace Cpp {
 namespace Class {
@@ -14,13 +22,25 @@ class PostProcessor
 {
 public:
     PostProcessor(std::shared_ptr<Config> config);
-    void process(std::vector<Class>& classes);
+    // the classes and enums of all models of the project, so a model can derive from, contain and include classes of
+    // another
+    void index(std::vector<Class> classes, const std::vector<Enum::Enum>& enums = {});
+    void process(std::vector<Class>& classes, const std::vector<Enum::Enum>& enums = {});
 
 private:
     std::shared_ptr<Config> m_config;
 
+    StructOfArrays m_structOfArrays;
+    FinalSpecifiers m_finalSpecifiers;
     IncludeGatherer m_gatherer;
+    IncludeGraph m_includeGraph;
     MemberSorter m_sorter;
+    MemberLayoutOptimizer m_layoutOptimizer;
+    SpecialMembers m_specialMembers;
+    EqualityAndHash m_equalityAndHash;
+    MemberReflection m_memberReflection;
+
+    bool m_indexed = false;
 };
 
 } // namespace Class
@@ -3,21 +3,24 @@
 #include <string>
 
 #include "Class.h"
+#include "Cpp/Common/CodeEmitter.h"
 #include "Cpp/Common/CodeGeneratorUtils.h"
+#include "Cpp/Common/TypeRenderer.h"
 
 namespace Cpp::Class {
 
 class SourceGenerator
 {
 public:
-    explicit SourceGenerator(std::shared_ptr<Config> config);
+    explicit SourceGenerator(std::shared_ptr<Config> config,
+                             std::shared_ptr<Common::TypeRenderer> typeRenderer =
+                                 std::make_shared<Common::TypeRenderer>());
     std::string generate(const Class& in);
 
 private:
-    std::string typeToString(const Common::Type& t);
-
     std::shared_ptr<Config> m_config;
     Common::CodeGeneratorUtils m_genUtils;
+    std::shared_ptr<Common::TypeRenderer> m_typeRenderer;
 };
 
 } // namespace Cpp::Class
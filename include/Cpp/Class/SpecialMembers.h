@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Config.h"
+
+#include "Cpp/Class/Class.h"
+#include "Cpp/Common/ModelIndex.h"
+
+namespace Cpp::Class {
+
+// Declares the default constructor, the copy and move operations and the destructor of a class as defaulted, so
+// downstream additions like a destructor don't silently turn moves into copies. Copies and moves are deleted if a
+// base or member can't be copied or moved, and moves are noexcept unless one of them may throw while moving. Model
+// types are judged by their own bases and members, the classes of other models by what index found.
+class SpecialMembers
+{
+public:
+    explicit SpecialMembers(std::shared_ptr<Config> config);
+    // judges the classes of all models of the project
+    void index(const std::vector<Class>& classes);
+    void add(std::vector<Class>& classes);
+
+private:
+    struct Traits
+    {
+        bool copyable    = true;
+        bool movable     = true;
+        bool nothrowMove = true;
+        Traits& operator&=(const Traits& other);
+    };
+
+    // helper methods
+    void indexClasses(const std::vector<Class>& classes);
+    Traits traits(const std::vector<Class>& classes, size_t index);
+    Traits traits(const std::vector<Class>& classes, const Class& scope, const Common::Type& type);
+    bool wanted(const Class& c) const;
+    std::vector<ClassElement> declarations(const Class& c, const Traits& traits) const;
+
+    std::shared_ptr<Config> m_config;
+
+    Common::ModelIndex<size_t> m_classIndex;
+    std::vector<Common::VisitState> m_states;
+    std::vector<Traits> m_traits;
+
+    Common::ModelIndex<Traits> m_projectTraits;
+};
+
+} // namespace Cpp::Class
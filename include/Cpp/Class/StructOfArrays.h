@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Config.h"
+
+#include "Cpp/Class/Class.h"
+
+namespace Cpp::Class {
+
+// Adds a struct-of-arrays companion <Name>SoA for every type with the stereotype SoA whose data members are all public:
+// one vector per data member, a proxy to the members of one element, and the usual container functions. Compositions
+// of many SoA structs are stored in the companion (see Translator).
+class StructOfArrays
+{
+public:
+    explicit StructOfArrays(std::shared_ptr<Config> config);
+    void addCompanions(std::vector<Class>& classes);
+    // the stereotype SoA and at least one data member, all of them public
+    static bool hasCompanion(const Class& c);
+
+private:
+    // helper methods
+    Class companion(const Class& c, const std::vector<const Variable*>& members) const;
+
+    std::shared_ptr<Config> m_config;
+};
+
+} // namespace Cpp::Class
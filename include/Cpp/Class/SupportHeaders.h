@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Config.h"
+#include "File.h"
+
+#include "Cpp/Class/Class.h"
+
+namespace Cpp::Class {
+
+// Generates the headers of the types the aggregation policies refer to (RefCounted, IntrusivePtr, Handle and
+// ObjectPool), of the wire format (Wire) and of the member hashes (Hash) into the folder PlantUML2Cpp of the headers
+// folder, where they can't collide with the headers of the model, but only those the classes of the project include.
+class SupportHeaders
+{
+public:
+    explicit SupportHeaders(std::shared_ptr<Config> config);
+    std::vector<File> generate(const std::vector<Class>& classes) const;
+
+    // the include of the support header with the name, relative to the headers folder
+    static std::string include(std::string_view name, const Config& config);
+    // the include of the support header declaring a type the generated code uses, like Handle
+    static std::optional<std::string> includeOfType(const std::string& type, const Config& config);
+
+private:
+    std::shared_ptr<Config> m_config;
+};
+
+} // namespace Cpp::Class
@@ -5,6 +5,7 @@
 
 #include "Config.h"
 #include "Cpp/Class/Class.h"
+#include "Cpp/Common/ModelIndex.h"
 #include "Cpp/Common/TranslatorUtils.h"
 
 #include "PlantUml/AbstractVisitor.h"
@@ -16,7 +17,10 @@ class Translator : public PlantUml::AbstractVisitor
 {
 public:
     explicit Translator(std::shared_ptr<Config> config);
-    std::vector<Class> results() &&;
+    // adds the types of the model with a struct-of-arrays companion
+    void indexCompanions(Common::ModelIndex<bool>& companions) const;
+    // compositions of many elements of a type with a companion, in the model or in companions, store them there
+    std::vector<Class> results(const Common::ModelIndex<bool>& companions = {}) &&;
 
     bool visit(const PlantUml::Variable& v) override;
     bool visit(const PlantUml::Method& m) override;
@@ -31,6 +35,20 @@ public:
     bool visit(const PlantUml::End& e) override;
 
 private:
+    // the type of some relationships depends on the stereotype of the object, which may be defined later
+    struct PendingRelationship
+    {
+        size_t classIndex;
+        size_t elementIndex;
+        std::list<std::string> object;
+        std::list<std::string> namespaceStack;
+        std::string cardinality;
+    };
+
+    // helper methods
+    PendingRelationship pending(const PlantUml::Relationship& r) const;
+    void resolveAggregation(const PendingRelationship& aggregation);
+
     // variables
     PlantUml::Visibility m_lastVisibility = PlantUml::Visibility::Unspecified;
     std::vector<Class> m_classes;
@@ -38,6 +56,8 @@ private:
     std::list<size_t> m_namespaceSizes;
     std::vector<Class>::iterator m_lastEncounteredClass = m_classes.end();
     bool m_lastClassFromExternalDef                     = false;
+    std::vector<PendingRelationship> m_multiValuedCompositions;
+    std::vector<PendingRelationship> m_aggregations;
     std::shared_ptr<Config> m_config;
     Common::TranslatorUtils m_utils;
 };
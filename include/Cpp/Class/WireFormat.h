@@ -0,0 +1,64 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Config.h"
+#include "File.h"
+
+#include "Cpp/Class/Class.h"
+#include "Cpp/Common/CodeGeneratorUtils.h"
+#include "Cpp/Common/ModelIndex.h"
+#include "Cpp/Common/TypeRenderer.h"
+#include "Cpp/Enum/Enum.h"
+
+namespace Cpp::Class {
+
+// Generates a flat little-endian binary format for structs: a <Name>Wire.h next to the header of the struct with a
+// <Name>View and the functions Wire.h calls to write and read it, reading returns views into the buffer for strings
+// and vectors. Only structs without bases get one that have non-static data members, all of them public and
+// wireScalarTypes, model enums, strings, vectors of scalars or enums or such structs. The structs and enums of other
+// models come from index.
+class WireFormat
+{
+public:
+    WireFormat(std::shared_ptr<Config> config, std::shared_ptr<Common::TypeRenderer> typeRenderer);
+    // selects the structs of all models of the project and remembers which of them have a wire format
+    void index(std::vector<Class>& classes, const std::vector<Enum::Enum>& enums);
+    void select(std::vector<Class>& classes, const std::vector<Enum::Enum>& enums);
+    File generate(const Class& c);
+
+private:
+    struct ModelType
+    {
+        Class* c                 = nullptr;
+        const Enum::Enum* e      = nullptr;
+        Common::VisitState state = Common::VisitState::Pending;
+        bool hasWireFormat       = false;
+    };
+
+    // a struct or enum of the project
+    struct ProjectType
+    {
+        std::list<std::string> namespaces;
+        std::string name;
+        bool isEnum        = false;
+        bool hasWireFormat = false;
+    };
+
+    // helper methods
+    ModelType* analyze(const std::list<std::string>& scope, const std::string& type);
+    bool isScalar(const std::list<std::string>& scope, const Common::Type& type);
+    std::string includePath(const std::list<std::string>& namespaces, const std::string& name) const;
+
+    std::shared_ptr<Config> m_config;
+    std::shared_ptr<Common::TypeRenderer> m_typeRenderer;
+    Common::CodeGeneratorUtils m_genUtils;
+
+    Common::ModelIndex<ModelType> m_types;
+    Common::ModelIndex<ProjectType> m_project;
+};
+
+} // namespace Cpp::Class
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace Cpp::Common {
+
+// Appends generated code directly into one growing buffer instead of concatenating temporary strings.
+class CodeEmitter
+{
+public:
+    explicit CodeEmitter(size_t expectedSize = 0);
+
+    CodeEmitter& operator<<(std::string_view text);
+    CodeEmitter& operator<<(char c);
+
+    // emits all elements of range using emitElement(CodeEmitter&, const Element&), separated by separator
+    template <typename Range, typename EmitElement>
+    CodeEmitter& join(const Range& range, std::string_view separator, EmitElement&& emitElement)
+    {
+        bool first = true;
+        for (const auto& element : range) {
+            if (!first) {
+                *this << separator;
+            }
+            emitElement(*this, element);
+            first = false;
+        }
+        return *this;
+    }
+
+    void reserve(size_t size);
+    size_t size() const;
+    std::string str() const;
+
+private:
+    fmt::memory_buffer m_buffer;
+};
+
+} // namespace Cpp::Common
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <list>
+#include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 
+#include "CodeEmitter.h"
 #include "Config.h"
 
 #include "PlantUml/ModelElement.h"
@@ -15,11 +18,22 @@ class CodeGeneratorUtils
 public:
     explicit CodeGeneratorUtils(std::shared_ptr<Config> config);
 
-    std::string openNamespaces(const std::list<std::string>& namespaces);
-    std::string closeNamespaces(const std::list<std::string>& namespaces);
+    void openNamespaces(CodeEmitter& out, const std::list<std::string>& namespaces);
+    void closeNamespaces(CodeEmitter& out, const std::list<std::string>& namespaces);
 
 private:
+    struct NamespaceBlock
+    {
+        std::string open;
+        std::string close;
+    };
+
+    const NamespaceBlock& namespaceBlock(const std::list<std::string>& namespaces);
+
     std::shared_ptr<Config> m_config;
+    // rendered prologue and epilogue per namespace path, most classes of a project share a few paths
+    std::shared_mutex m_mutex;
+    std::map<std::list<std::string>, NamespaceBlock> m_namespaceBlocks;
 };
 
-} // namespace Cpp::Common
\ No newline at end of file
+} // namespace Cpp::Common
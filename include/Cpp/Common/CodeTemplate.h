@@ -0,0 +1,58 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CodeEmitter.h"
+
+namespace Cpp::Common {
+
+// A layout for generated files, e.g. "#pragma once\n\n{{includes}}...". The template text is compiled once into a
+// sequence of literal text and placeholder instructions. Rendering walks this sequence and lets the generator emit
+// the content of each placeholder, so the template is never parsed again.
+class CodeTemplate
+{
+public:
+    CodeTemplate(std::string_view text, const std::vector<std::string_view>& placeholders);
+
+    // compiles the template in file or, if there is no such file, the fallback
+    static CodeTemplate fromFile(const std::filesystem::path& file,
+                                 std::string_view fallback,
+                                 const std::vector<std::string_view>& placeholders);
+
+    // emitPlaceholder(CodeEmitter&, size_t) is called with the index of the placeholder in the list given on compilation
+    template <typename EmitPlaceholder>
+    void render(CodeEmitter& out, EmitPlaceholder&& emitPlaceholder) const
+    {
+        for (const auto& instruction : m_instructions) {
+            if (instruction.placeholder == literal) {
+                out << std::string_view(m_literals).substr(instruction.offset, instruction.length);
+            } else {
+                emitPlaceholder(out, instruction.placeholder);
+            }
+        }
+    }
+
+    size_t literalSize() const;
+    // whether the template uses the placeholder with the index given
+    bool contains(size_t placeholder) const;
+
+private:
+    static constexpr size_t literal = static_cast<size_t>(-1);
+
+    struct Instruction
+    {
+        size_t placeholder = literal;
+        size_t offset      = 0;
+        size_t length      = 0;
+    };
+
+    void addLiteral(std::string_view text);
+
+    std::string m_literals;
+    std::vector<Instruction> m_instructions;
+};
+
+} // namespace Cpp::Common
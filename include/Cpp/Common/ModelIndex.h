@@ -0,0 +1,72 @@
+#pragma once
+
+#include <list>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace Cpp::Common {
+
+// Where a model type is in a depth first walk over the types it derives from or contains. A type that is reached
+// again while it is in progress contains itself.
+enum class VisitState
+{
+    Pending,
+    InProgress,
+    Done
+};
+
+// "ns::inner::Name" for a type declared in the namespaces given
+std::string qualifiedName(const std::list<std::string>& namespaces, const std::string& name);
+
+// Entries for the types of the model by their fully qualified name. Names are looked up like the compiler does, in
+// the namespace of the user first and then outwards, names starting with "::" only from the global namespace.
+template <typename Entry>
+class ModelIndex
+{
+public:
+    void clear() { m_entries.clear(); }
+
+    // the first type with a name wins, later ones are ignored
+    void add(const std::list<std::string>& namespaces, const std::string& name, Entry entry)
+    {
+        m_entries.emplace(qualifiedName(namespaces, name), std::move(entry));
+    }
+
+    Entry* find(const std::list<std::string>& scope, const std::string& type)
+    {
+        return const_cast<Entry*>(std::as_const(*this).find(scope, type));
+    }
+
+    const Entry* find(const std::list<std::string>& scope, const std::string& type) const
+    {
+        if (type.starts_with("::")) {
+            auto it = m_entries.find(type.substr(2));
+            return it == m_entries.end() ? nullptr : &it->second;
+        }
+
+        for (size_t depth = scope.size() + 1; depth-- > 0;) {
+            std::string name;
+            for (const auto& ns : scope | std::views::take(depth)) {
+                name += ns + "::";
+            }
+            if (auto it = m_entries.find(name + type); it != m_entries.end()) {
+                return &it->second;
+            }
+        }
+        return nullptr;
+    }
+
+    // the entry of exactly this type, without looking in outer namespaces
+    const Entry* at(const std::list<std::string>& namespaces, const std::string& name) const
+    {
+        auto it = m_entries.find(qualifiedName(namespaces, name));
+        return it == m_entries.end() ? nullptr : &it->second;
+    }
+
+private:
+    std::unordered_map<std::string, Entry> m_entries;
+};
+
+} // namespace Cpp::Common
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Cpp::Common {
+
+// A hash without collisions for a fixed set of keys, searched for at generation time, so generated code finds a key
+// with two hashes and one comparison. A first hash selects a bucket, the seed found for the bucket selects the slot:
+//     slot = hash(key, seeds[hash(key, 0) >> bucketShift]) >> slotShift
+// The hash is a seeded FNV-1a with a final mix, since FNV-1a alone spreads keys that differ in their last byte badly:
+//     h = 2166136261u ^ seed; for each byte c: h = (h ^ c) * 16777619u; h ^= h >> 15; h *= 0x2c1b3c6du; h ^= h >> 12
+struct PerfectHash
+{
+    std::uint32_t bucketShift = 31;
+    std::uint32_t slotShift   = 31;
+    std::vector<std::uint32_t> seeds;
+    // the index of the key in each slot plus one, 0 for empty slots
+    std::vector<size_t> slots;
+
+    // std::nullopt for duplicate keys, or if no seeds place all keys
+    static std::optional<PerfectHash> build(const std::vector<std::string_view>& keys);
+    static std::uint32_t hash(std::string_view key, std::uint32_t seed);
+
+    size_t find(std::string_view key) const;
+};
+
+} // namespace Cpp::Common
@@ -4,6 +4,7 @@
 #include <concepts>
 #include <list>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -31,10 +32,17 @@ public:
 
     Type umlToCppType(PlantUml::Type umlType);
     Type stringToCppType(std::string_view typeString);
+    // the configured container for the cardinality, or else one that fits its bounds
+    Type compositionType(const std::string& cardinality, const std::string& type);
+    // a pointer or handle of the policy, in a std::vector if the cardinality allows many, unknown policies are shared
+    Type aggregationType(const std::string& cardinality, const std::string& type, const std::string& policy);
     static std::string visibilityToString(PlantUml::Visibility vis);
 
 private:
     std::shared_ptr<Config> m_config;
+
+    // policies already warned about
+    std::set<std::string> m_unknownPolicies;
 };
 
 std::string toNamespacedString(std::list<std::string> namespacedType);
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+
+#include "Config.h"
+#include "Type.h"
+
+namespace Cpp::Common {
+
+struct Layout
+{
+    size_t size      = 0;
+    size_t alignment = 1;
+};
+
+// Estimates size and alignment of types the way a typical 64 bit compiler lays them out. Types are looked up in the
+// type layout table of the config, types the table doesn't know (e.g. model types) are passed to a resolver.
+class TypeLayout
+{
+public:
+    using Resolver = std::function<std::optional<Layout>(const std::string& type)>;
+
+    explicit TypeLayout(std::shared_ptr<Config> config);
+
+    std::optional<Layout> layoutOf(const Type& type, const Resolver& resolve = {}) const;
+
+    // layout of a struct with these members in this order, including padding
+    static Layout structLayout(std::span<const Layout> members);
+
+private:
+    std::shared_ptr<Config> m_config;
+};
+
+} // namespace Cpp::Common
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Type.h"
+
+namespace Cpp::Common {
+
+// Renders types to their C++ spelling. Every distinct type is interned once (hash-consed on its base and the ids of
+// its template parameters) and its spelling is cached, so rendering a type that was seen before is a lookup per node
+// without building any strings. Rendering is thread-safe, known types only take a shared lock.
+class TypeRenderer
+{
+public:
+    std::string_view render(const Type& type);
+
+private:
+    // a node is identified by its interned spelling, which never moves
+    using Id = const std::string*;
+
+    struct NodeKey
+    {
+        std::string_view base;
+        std::span<const Id> templateParams;
+    };
+
+    struct Node
+    {
+        std::string base;
+        std::vector<Id> templateParams;
+    };
+
+    struct NodeHash
+    {
+        using is_transparent = void;
+        size_t operator()(const NodeKey& key) const;
+        size_t operator()(const Node& node) const;
+    };
+
+    struct NodeEqual
+    {
+        using is_transparent = void;
+        bool operator()(const NodeKey& l, const NodeKey& r) const;
+        bool operator()(const Node& l, const NodeKey& r) const;
+        bool operator()(const NodeKey& l, const Node& r) const;
+        bool operator()(const Node& l, const Node& r) const;
+    };
+
+    Id intern(const Type& type);
+    Id insert(NodeKey key);
+
+    std::shared_mutex m_mutex;
+    std::unordered_map<Node, Id, NodeHash, NodeEqual> m_ids;
+    std::deque<std::string> m_spellings; // a deque keeps the rendered strings in place
+};
+
+} // namespace Cpp::Common
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <string>
 #include <vector>
@@ -12,6 +13,20 @@ struct Enum
     std::string name;
     std::list<std::string> namespaces;
     std::string comment;
+    std::string stereotype;
+    // empty for the compiler's default
+    std::string underlyingType;
     std::vector<Enumerator> enumerators;
 };
+
+// the value of every enumerator, counting on from the previous one where none is given like the compiler does
+inline std::vector<std::int64_t> values(const Enum& e)
+{
+    std::vector<std::int64_t> result;
+    result.reserve(e.enumerators.size());
+    for (const auto& enumerator : e.enumerators) {
+        result.push_back(enumerator.value.value_or(result.empty() ? 0 : result.back() + 1));
+    }
+    return result;
+}
 } // namespace Cpp::Enum
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <string>
 
 namespace Cpp::Enum {
 struct Enumerator
 {
     std::string name;
+    std::optional<std::int64_t> value;
 };
 } // namespace Cpp::Enum
@@ -4,7 +4,9 @@
 #include <string>
 
 #include "Config.h"
+#include "Cpp/Common/CodeEmitter.h"
 #include "Cpp/Common/CodeGeneratorUtils.h"
+#include "Cpp/Common/CodeTemplate.h"
 #include "Enum.h"
 
 namespace Cpp::Enum {
@@ -16,7 +18,16 @@ public:
     std::string generate(const Enum& in);
 
 private:
+    // helper methods
+    bool reflects(const Enum& in) const;
+    bool isFlags(const Enum& in) const;
+    void generateIncludes(Common::CodeEmitter& out, const Enum& in) const;
+    void generateDefinitions(Common::CodeEmitter& out, const Enum& in) const;
+    void generateFlagOperators(Common::CodeEmitter& out, const Enum& in) const;
+    void generateReflection(Common::CodeEmitter& out, const Enum& in) const;
+
     std::shared_ptr<Config> m_config;
     Common::CodeGeneratorUtils m_genUtils;
+    Common::CodeTemplate m_template;
 };
 } // namespace Cpp::Enum
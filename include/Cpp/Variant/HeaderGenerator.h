@@ -4,7 +4,10 @@
 #include <string>
 
 #include "Config.h"
+#include "Cpp/Common/CodeEmitter.h"
 #include "Cpp/Common/CodeGeneratorUtils.h"
+#include "Cpp/Common/CodeTemplate.h"
+#include "Cpp/Common/TypeRenderer.h"
 #include "Variant.h"
 
 namespace Cpp::Variant {
@@ -12,12 +15,22 @@ namespace Cpp::Variant {
 class HeaderGenerator
 {
 public:
-    explicit HeaderGenerator(std::shared_ptr<Config> config);
+    explicit HeaderGenerator(std::shared_ptr<Config> config,
+                             std::shared_ptr<Common::TypeRenderer> typeRenderer =
+                                 std::make_shared<Common::TypeRenderer>());
 
     std::string generate(const Variant& in);
 
 private:
+    // helper methods
+    bool dispatches(const Variant& in) const;
+    void generateDispatch(Common::CodeEmitter& out, const Variant& in);
+    void generateTaggedUnion(Common::CodeEmitter& out, const Variant& in);
+
     std::shared_ptr<Config> m_config;
     Common::CodeGeneratorUtils m_genUtils;
+    std::shared_ptr<Common::TypeRenderer> m_typeRenderer;
+    Common::CodeTemplate m_template;
+    Common::CodeTemplate m_taggedUnionTemplate;
 };
 } // namespace Cpp::Variant
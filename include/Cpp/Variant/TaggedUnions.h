@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Config.h"
+
+#include "Cpp/Class/Class.h"
+#include "Cpp/Common/ModelIndex.h"
+#include "Cpp/Common/TypeLayout.h"
+#include "Cpp/Enum/Enum.h"
+#include "Variant.h"
+
+namespace Cpp::Variant {
+
+// Selects the variants that are generated as compact tagged unions: all alternatives are distinct trivially copyable
+// types of the model. A model class is trivially copyable if it isn't polymorphic and its bases and data members are,
+// data members may also be pointers, model enums, triviallyCopyableTypes or std::array and std::optional of these.
+// Alternatives named Index or index would collide with the members of the union and keep the std::variant.
+class TaggedUnions
+{
+public:
+    explicit TaggedUnions(std::shared_ptr<Config> config);
+    void select(std::vector<Variant>& variants,
+                const std::vector<Class::Class>& classes,
+                const std::vector<Enum::Enum>& enums);
+
+private:
+    struct ModelType
+    {
+        const Class::Class* c    = nullptr;
+        const Enum::Enum* e      = nullptr;
+        Common::VisitState state = Common::VisitState::Pending;
+        bool triviallyCopyable   = false;
+        std::optional<Common::Layout> layout;
+    };
+
+    // helper methods
+    ModelType* analyze(const std::list<std::string>& scope, const std::string& type);
+    bool triviallyCopyable(const std::list<std::string>& scope, const Common::Type& type);
+    std::optional<Common::Layout> layoutOf(const std::list<std::string>& scope, const Common::Type& type);
+
+    std::shared_ptr<Config> m_config;
+    Common::TypeLayout m_typeLayout;
+
+    Common::ModelIndex<ModelType> m_types;
+};
+
+} // namespace Cpp::Variant
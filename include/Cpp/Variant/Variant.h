@@ -1,6 +1,7 @@
 #pragma once
 
 #include <list>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -14,5 +15,9 @@ struct Variant
     std::list<std::string> namespaces;
     std::string comment;
     std::vector<Common::Type> containedTypes;
+
+    // generated as a compact tagged union instead of a std::variant, with its estimated size if the layout is known
+    bool isTaggedUnion = false;
+    std::optional<size_t> estimatedSize;
 };
 } // namespace Cpp::Variant
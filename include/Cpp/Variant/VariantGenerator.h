@@ -7,17 +7,21 @@
 #include "Generator.h"
 #include "HeaderGenerator.h"
 #include "PlantUml/SyntaxNode.h"
+#include "TaggedUnions.h"
 
 namespace Cpp::Variant {
 class VariantGenerator : public Generator
 {
 public:
-    explicit VariantGenerator(std::shared_ptr<Config> config);
+    explicit VariantGenerator(std::shared_ptr<Config> config,
+                              std::shared_ptr<Common::TypeRenderer> typeRenderer =
+                                  std::make_shared<Common::TypeRenderer>());
     std::vector<File> generate(PlantUml::SyntaxNode root) override;
 
 private:
     std::shared_ptr<Config> m_config;
 
+    TaggedUnions m_taggedUnions;
     HeaderGenerator m_headerGenerator;
 };
 } // namespace Cpp::Variant
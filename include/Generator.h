@@ -8,5 +8,7 @@
 class Generator
 {
 public:
+    // called with all models of the project before any of them is generated
+    virtual void prepare(const std::vector<const PlantUml::SyntaxNode*>& /*models*/) {}
     virtual std::vector<File> generate(PlantUml::SyntaxNode root) = 0;
 };
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+
+#include "PlantUml/Parser.h"
+#include "PlantUml/SyntaxNode.h"
+
+// Reads and parses model files. The parser (and with it the grammar) is only built once the first file needs parsing
+// and is then reused for all files. The resulting ASTs are cached until the model file changes, so repeated runs on
+// the same project only parse what was modified.
+class ModelLoader
+{
+public:
+    // returns nullptr if the file could not be parsed
+    const PlantUml::SyntaxNode* load(const std::filesystem::path& modelFile);
+
+private:
+    struct CachedModel
+    {
+        std::filesystem::file_time_type lastWriteTime;
+        bool parsed = false;
+        PlantUml::SyntaxNode ast;
+    };
+
+    std::unique_ptr<PlantUml::Parser> m_parser;
+    std::unordered_map<std::string, CachedModel> m_cache;
+};
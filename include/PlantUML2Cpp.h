@@ -5,15 +5,19 @@
 
 #include "Config.h"
 #include "Generator.h"
-#include "PlantUml/Parser.h"
+#include "ModelLoader.h"
 
 class PlantUML2Cpp
 {
 public:
-    PlantUML2Cpp(std::shared_ptr<Config> config);
+    explicit PlantUML2Cpp(std::shared_ptr<Config> config,
+                          std::shared_ptr<ModelLoader> loader = std::make_shared<ModelLoader>());
     bool run();
 
 private:
+    const std::vector<std::unique_ptr<Generator>>& generators();
+
     std::shared_ptr<Config> m_config;
+    std::shared_ptr<ModelLoader> m_loader;
     std::vector<std::unique_ptr<Generator>> m_generators;
 };
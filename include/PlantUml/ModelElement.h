@@ -72,6 +72,8 @@ struct Element
 struct Enumerator
 {
     std::string name;
+    // the explicit value as written, empty if there is none
+    std::string value;
 
     bool operator==(const Enumerator&) const = default;
 };
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Config.h"
+#include "ModelLoader.h"
+#include "PlantUML2Cpp.h"
+
+// Keeps parser, configs and parsed models in memory and runs generation requests sent by clients over a local socket.
+// A client sends its working directory and command line, the server answers with the exit code and the output.
+class Server
+{
+public:
+    explicit Server(std::filesystem::path socketPath);
+    ~Server();
+    Server(const Server&)            = delete;
+    Server& operator=(const Server&) = delete;
+
+    // listens and answers requests until the process ends
+    bool run();
+    // binds the socket, a socket left behind by a previous server is replaced but no other kind of file
+    bool listen();
+    // waits for the next client and answers its request
+    void answer();
+
+    // sends the command line to a running server and prints its output, returns the exit code of the request
+    static int forward(const std::filesystem::path& socketPath, int argc, char** argv);
+
+    // runs a request, the working directory of the client followed by its command line, and returns the exit code
+    int handle(const std::vector<std::string>& request, std::string& out, std::string& err);
+
+private:
+    struct Project
+    {
+        std::shared_ptr<Config> config;
+        std::unique_ptr<PlantUML2Cpp> generator;
+        std::filesystem::file_time_type configWriteTime;
+    };
+
+    int generate(const std::vector<std::string>& request);
+
+    std::filesystem::path m_socketPath;
+    int m_listener = -1;
+    std::shared_ptr<ModelLoader> m_loader;
+    std::unordered_map<std::string, Project> m_projects;
+};
@@ -0,0 +1,112 @@
+#include "ArchiveWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <numeric>
+
+namespace {
+
+constexpr size_t blockSize  = 512;
+constexpr size_t nameSize   = 100;
+constexpr size_t prefixSize = 155;
+
+using Block = std::array<char, blockSize>;
+
+// writes value as zero padded octal number into a field of the given width (including the terminating NUL)
+void writeOctal(Block& block, size_t offset, size_t width, size_t value)
+{
+    for (size_t i = width - 1; i-- > 0; value >>= 3) {
+        block[offset + i] = static_cast<char>('0' + (value & 7));
+    }
+    block[offset + width - 1] = '\0';
+}
+
+void writeString(Block& block, size_t offset, std::string_view value)
+{
+    std::ranges::copy(value, block.begin() + static_cast<std::ptrdiff_t>(offset));
+}
+
+} // namespace
+
+ArchiveWriter::ArchiveWriter(std::ostream& out)
+    : m_out(out)
+{
+}
+
+bool ArchiveWriter::add(const std::filesystem::path& relativePath, std::string_view content)
+{
+    if (m_finished || !writeHeader(relativePath.generic_string(), content.size())) {
+        return false;
+    }
+
+    m_out.write(content.data(), static_cast<std::streamsize>(content.size()));
+
+    // pad content to the next full block
+    Block padding{};
+    if (auto rest = content.size() % blockSize; rest != 0) {
+        m_out.write(padding.data(), static_cast<std::streamsize>(blockSize - rest));
+    }
+
+    return m_out.good();
+}
+
+bool ArchiveWriter::add(const File& file, const std::filesystem::path& basePath)
+{
+    if (file.path.empty()) {
+        return false;
+    }
+
+    return add(file.path.lexically_relative(basePath), file.content);
+}
+
+bool ArchiveWriter::finish()
+{
+    if (!m_finished) {
+        // the end of an archive is marked by two empty blocks
+        Block empty{};
+        m_out.write(empty.data(), blockSize);
+        m_out.write(empty.data(), blockSize);
+        m_out.flush();
+        m_finished = true;
+    }
+
+    return m_out.good();
+}
+
+bool ArchiveWriter::writeHeader(const std::string& path, size_t size)
+{
+    // ustar splits paths longer than the name field into a prefix and a name at a directory separator
+    std::string_view prefix;
+    std::string_view name = path;
+    if (name.size() > nameSize) {
+        auto split = name.find('/', name.size() - nameSize - 1);
+        if (split == std::string_view::npos || split > prefixSize) {
+            std::cout << "path too long for archive: " << path << std::endl;
+            return false;
+        }
+        prefix = name.substr(0, split);
+        name   = name.substr(split + 1);
+    }
+
+    Block header{};
+    writeString(header, 0, name);
+    writeOctal(header, 100, 8, 0644); // mode
+    writeOctal(header, 108, 8, 0);    // uid
+    writeOctal(header, 116, 8, 0);    // gid
+    writeOctal(header, 124, 12, size);
+    writeOctal(header, 136, 12, 0); // mtime
+    header[156] = '0';              // regular file
+    writeString(header, 257, "ustar");
+    writeString(header, 263, "00");
+    writeString(header, 345, prefix);
+
+    // the checksum is calculated with the checksum field itself filled with spaces
+    std::fill_n(header.begin() + 148, 8, ' ');
+    auto checksum = std::accumulate(
+        header.begin(), header.end(), size_t(0), [](size_t acc, char c) { return acc + static_cast<unsigned char>(c); });
+    writeOctal(header, 148, 7, checksum);
+
+    m_out.write(header.data(), blockSize);
+    return m_out.good();
+}
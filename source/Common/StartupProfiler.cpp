@@ -0,0 +1,52 @@
+#include "Common/StartupProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// static initialization is the earliest point in the process we can measure from
+Clock::time_point start    = Clock::now();
+Clock::time_point lastMark = start;
+std::vector<std::pair<std::string, Clock::duration>> phases;
+
+} // namespace
+
+void StartupProfiler::mark(std::string_view phase)
+{
+    auto now = Clock::now();
+
+    auto it = std::ranges::find(phases, phase, &std::pair<std::string, Clock::duration>::first);
+    if (it == phases.end()) {
+        phases.emplace_back(phase, now - lastMark);
+    } else {
+        it->second += now - lastMark;
+    }
+
+    lastMark = now;
+}
+
+void StartupProfiler::report(std::ostream& out)
+{
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    if (phases.empty()) {
+        return;
+    }
+
+    size_t width = std::ranges::max(phases, {}, [](const auto& p) { return p.first.size(); }).first.size();
+
+    out << "startup profile:\n" << std::fixed << std::setprecision(3);
+    for (const auto& [phase, duration] : phases) {
+        out << "  " << std::left << std::setw(static_cast<int>(width)) << phase << std::right << std::setw(10)
+            << Milliseconds(duration).count() << " ms\n";
+    }
+    out << "  " << std::left << std::setw(static_cast<int>(width)) << "total" << std::right << std::setw(10)
+        << Milliseconds(lastMark - start).count() << " ms" << std::endl;
+}
@@ -1,5 +1,10 @@
 #include "Config.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+
 #include "CLI/App.hpp"
 #include "CLI/Config.hpp"
 #include "CLI/Formatter.hpp"
@@ -7,14 +12,17 @@
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
+#include <fmt/format.h>
 #include <spdlog/spdlog.h>
 
-bool Config::parseAndLoad(int argc, char** argv)
+#include "Common/StartupProfiler.h"
+
+bool Config::parseAndLoad(int argc, char** argv, const std::filesystem::path& workingDirectory)
 {
     CLI::App app{"PlantUML2Cpp -- translate PlantUML class diagrams to C++ code"};
 
     // Set up the command line options and flags
-    std::string pathString = m_projectPath.string();
+    std::string pathString = workingDirectory.empty() ? m_projectPath.string() : workingDirectory.string();
     app.add_option("path", pathString, "Path to project directory (default: current path)");
     app.add_option(
         "-c,--config",
@@ -22,6 +30,10 @@ bool Config::parseAndLoad(int argc, char** argv)
         "Path to the folder containing the config.json, relative to project directory (default: \"models\")");
 
     app.add_flag("-f", m_overwriteExistingFiles, "Overwrite existing files when generating code");
+    app.add_option("-a,--archive",
+                   m_archivePath,
+                   "Stream all generated files into a single tar archive instead of writing them one by one (\"-\" "
+                   "for stdout)");
 
     app.add_option("-m,--models", m_modelFolderName, "Folder containing the PlantUML files (default: \"models\")");
     app.add_option(
@@ -38,6 +50,76 @@ bool Config::parseAndLoad(int argc, char** argv)
 
     app.add_flag("-M,--memberPrefixForStruct", m_memberPrefixForStructs, "Use the member prefix also in structs");
     app.add_flag("-n,--concatenateNamespaces", m_concatenateNamespaces, "Use C++17's nested namespaces");
+    app.add_flag("--forwardDeclarations",
+                 m_forwardDeclarations,
+                 "Forward declare model types in headers that don't need the complete type and include them in the "
+                 "sources instead");
+    app.add_flag("--minimizeIncludes",
+                 m_minimizeIncludes,
+                 "Drop includes of model headers that are already included through another model header");
+    app.add_flag(
+        "--includeReport", m_includeReport, "Print the fan-in and fan-out of the includes between generated headers");
+    app.add_flag("--optimizeMemberLayout",
+                 m_optimizeMemberLayout,
+                 "Reorder data members within each access section to minimize padding");
+    app.add_flag("--groupByVisibility",
+                 m_groupByVisibility,
+                 "Group class members into public, protected and private sections, methods before data");
+    app.add_flag("--specialMembers",
+                 m_specialMembers,
+                 "Declare defaulted constructors, assignments and destructor in all classes, noexcept moves where the "
+                 "member types allow it");
+    app.add_flag("--finalClasses",
+                 m_finalClasses,
+                 "Declare classes final that derive from a modeled class and are not derived from themselves, and the "
+                 "methods overriding an abstract one in them");
+    app.add_flag("--memberReflection",
+                 m_memberReflection,
+                 "Generate a constexpr tuple of the names and member pointers of the data members in classes");
+    app.add_flag("--equalityAndHash",
+                 m_equalityAndHash,
+                 "Declare a defaulted operator== in structs and specialize std::hash for them from their members");
+    app.add_flag("--enumReflection",
+                 m_enumReflection,
+                 "Generate a name table, the enumerator count and constexpr conversions from and to strings for enums");
+    app.add_option("--enumUnderlyingType",
+                   m_enumUnderlyingType,
+                   "Underlying type of enums, \"auto\" for the smallest integer type holding all values");
+    app.add_flag("--variantDispatch",
+                 m_variantDispatch,
+                 "Generate an index enum, index traits and a switch based visit function for variants");
+    app.add_flag("--compactVariants",
+                 m_compactVariants,
+                 "Generate variants of trivially copyable model types as compact tagged unions");
+    app.add_flag("--wireFormat",
+                 m_wireFormat,
+                 "Generate a flat little-endian binary format for structs, read as views into the buffer");
+    app.add_option("--boundedContainer",
+                   m_boundedContainer,
+                   "Container for compositions with a bounded cardinality like \"0..8\", {} are the type and the bound, "
+                   "e.g. \"boost::container::static_vector<{}, {}>\" (default: none, std::vector)");
+    app.add_option("--maxInlineCapacity",
+                   m_maxInlineCapacity,
+                   "Largest bound of a cardinality that uses the bounded container, not std::vector (default: 16)");
+    app.add_option("--aggregationPolicy",
+                   m_aggregationPolicy,
+                   "How aggregations refer to their objects: shared, observer, weak, intrusive or pool (default: "
+                   "\"shared\")");
+    app.add_option("--classHeaderTemplate",
+                   m_classHeaderTemplate,
+                   "Template file for the layout of class headers, relative to the config folder");
+    app.add_option("--enumHeaderTemplate",
+                   m_enumHeaderTemplate,
+                   "Template file for the layout of enum headers, relative to the config folder");
+    app.add_option("--variantHeaderTemplate",
+                   m_variantHeaderTemplate,
+                   "Template file for the layout of variant headers, relative to the config folder (not used for "
+                   "compact variants)");
+
+    app.add_option("--server",
+                   m_serverSocket,
+                   "Run as a server listening on this local socket and keep parsers, configs and models in memory");
+    app.add_option("--client", m_clientSocket, "Forward the command line to a server listening on this local socket");
 
     bool writeConfig = false;
     app.add_flag(
@@ -47,6 +129,7 @@ bool Config::parseAndLoad(int argc, char** argv)
     app.add_flag("-v,--debug", verboseLogging, "Enable debug logging");
     bool tracing = false;
     app.add_flag("--trace", tracing, "Enable tracing on top of debug logging");
+    app.add_flag("--profile-startup", m_profileStartup, "Print the time spent in each phase of the run");
 
     // first parse the command line args to extract the project and config path
     // (all options and flags need to be present in case of -h or parser exception)
@@ -56,6 +139,7 @@ bool Config::parseAndLoad(int argc, char** argv)
         app.exit(e);
         return false;
     }
+    StartupProfiler::mark("command line parsing");
 
     // immediately set debug or trace logging if requested
     if (tracing) {
@@ -63,11 +147,18 @@ bool Config::parseAndLoad(int argc, char** argv)
     } else if (verboseLogging) {
         spdlog::set_level(spdlog::level::debug);
     }
+    StartupProfiler::mark("spdlog setup");
+
+    m_projectPath = workingDirectory / pathString;
 
-    m_projectPath = pathString;
+    // a client only forwards its command line, the server loads the config
+    if (!m_clientSocket.empty()) {
+        return true;
+    }
 
     // read config.json from configPath()
     readConfigFrom(configPath());
+    StartupProfiler::mark("config file");
 
     // now parse the command line arguments again to overwrite anything set by the config
     try {
@@ -76,6 +167,11 @@ bool Config::parseAndLoad(int argc, char** argv)
         app.exit(e);
         return false;
     }
+    StartupProfiler::mark("command line parsing");
+
+    if (!m_archivePath.empty() && m_archivePath != "-") {
+        m_archivePath = (workingDirectory / m_archivePath).string();
+    }
 
     // write config to configPath() if requested
     if (writeConfig) {
@@ -118,6 +214,51 @@ bool Config::overwriteExistingFiles() const
 {
     return m_overwriteExistingFiles;
 }
+std::filesystem::path Config::archivePath() const
+{
+    return m_archivePath;
+}
+std::filesystem::path Config::serverSocket() const
+{
+    return m_serverSocket;
+}
+std::filesystem::path Config::clientSocket() const
+{
+    return m_clientSocket;
+}
+std::filesystem::path Config::manifestPath() const
+{
+    return m_projectPath / ".plantuml2cpp";
+}
+bool Config::profileStartup() const
+{
+    return m_profileStartup;
+}
+std::string Config::fingerprint() const
+{
+    // sets are written in no particular order, sorting them keeps the fingerprint of equal settings equal
+    auto config = json::parse(settings(-1));
+    for (auto& value : config) {
+        if (value.is_array()) {
+            std::sort(value.begin(), value.end());
+        }
+    }
+
+    std::string text = config.dump() + '\n' + headersPath().string() + '\n' + sourcesPath().string();
+    for (const auto& path : {classHeaderTemplate(), enumHeaderTemplate(), variantHeaderTemplate()}) {
+        text += '\n';
+        if (std::ifstream in(path, std::ios_base::binary); !path.empty() && in.is_open()) {
+            text.append(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+    }
+
+    // 64 bit FNV-1a
+    std::uint64_t hash = 14695981039346656037u;
+    for (unsigned char c : text) {
+        hash = (hash ^ c) * 1099511628211u;
+    }
+    return fmt::format("{:016x}", hash);
+}
 
 const std::string& Config::memberPrefix() const
 {
@@ -136,6 +277,75 @@ bool Config::concatenateNamespaces() const
 {
     return m_concatenateNamespaces;
 }
+bool Config::forwardDeclarations() const
+{
+    return m_forwardDeclarations;
+}
+bool Config::minimizeIncludes() const
+{
+    return m_minimizeIncludes;
+}
+bool Config::includeReport() const
+{
+    return m_includeReport;
+}
+bool Config::optimizeMemberLayout() const
+{
+    return m_optimizeMemberLayout;
+}
+bool Config::groupByVisibility() const
+{
+    return m_groupByVisibility;
+}
+bool Config::specialMembers() const
+{
+    return m_specialMembers;
+}
+bool Config::finalClasses() const
+{
+    return m_finalClasses;
+}
+bool Config::memberReflection() const
+{
+    return m_memberReflection;
+}
+bool Config::equalityAndHash() const
+{
+    return m_equalityAndHash;
+}
+bool Config::enumReflection() const
+{
+    return m_enumReflection;
+}
+const std::string& Config::enumUnderlyingType() const
+{
+    return m_enumUnderlyingType;
+}
+bool Config::variantDispatch() const
+{
+    return m_variantDispatch;
+}
+bool Config::compactVariants() const
+{
+    return m_compactVariants;
+}
+bool Config::wireFormat() const
+{
+    return m_wireFormat;
+}
+std::filesystem::path Config::classHeaderTemplate() const
+{
+    return m_classHeaderTemplate.empty() ? std::filesystem::path() : configPath().parent_path() / m_classHeaderTemplate;
+}
+std::filesystem::path Config::enumHeaderTemplate() const
+{
+    return m_enumHeaderTemplate.empty() ? std::filesystem::path() : configPath().parent_path() / m_enumHeaderTemplate;
+}
+std::filesystem::path Config::variantHeaderTemplate() const
+{
+    return m_variantHeaderTemplate.empty() ? std::filesystem::path()
+                                           : configPath().parent_path() / m_variantHeaderTemplate;
+}
 
 const std::unordered_map<std::string, std::string>& Config::containerByCardinalityComposition() const
 {
@@ -145,6 +355,46 @@ const std::unordered_map<std::string, std::string>& Config::containerByCardinali
 {
     return m_containerByCardinalityAggregation;
 }
+const std::string& Config::boundedContainer() const
+{
+    return m_boundedContainer;
+}
+size_t Config::maxInlineCapacity() const
+{
+    return m_maxInlineCapacity;
+}
+const std::string& Config::aggregationPolicy() const
+{
+    return m_aggregationPolicy;
+}
+const std::unordered_map<std::string, std::string>& Config::aggregationPolicyByStereotype() const
+{
+    return m_aggregationPolicyByStereotype;
+}
+const std::unordered_set<std::string>& Config::specialMembersStereotypes() const
+{
+    return m_specialMembersStereotypes;
+}
+const std::unordered_set<std::string>& Config::nonCopyableTypes() const
+{
+    return m_nonCopyableTypes;
+}
+const std::unordered_set<std::string>& Config::nonMovableTypes() const
+{
+    return m_nonMovableTypes;
+}
+const std::unordered_set<std::string>& Config::throwingMoveTypes() const
+{
+    return m_throwingMoveTypes;
+}
+const std::unordered_set<std::string>& Config::triviallyCopyableTypes() const
+{
+    return m_triviallyCopyableTypes;
+}
+const std::unordered_set<std::string>& Config::wireScalarTypes() const
+{
+    return m_wireScalarTypes;
+}
 
 const std::unordered_map<std::string, std::string>& Config::typeToIncludeMap() const
 {
@@ -154,6 +404,10 @@ const std::unordered_map<std::string, std::string>& Config::umlToCppTypeMap() co
 {
     return m_umlToCppTypeMap;
 }
+const std::unordered_map<std::string, std::array<size_t, 2>>& Config::typeLayouts() const
+{
+    return m_typeLayouts;
+}
 
 void Config::readConfigFrom(std::filesystem::path configFilePath)
 {
@@ -196,6 +450,57 @@ void Config::readConfigFrom(std::filesystem::path configFilePath)
     if (config.contains("concatenateNamespaces"))
         m_concatenateNamespaces = config["concatenateNamespaces"].get<bool>();
 
+    if (config.contains("forwardDeclarations"))
+        m_forwardDeclarations = config["forwardDeclarations"].get<bool>();
+
+    if (config.contains("minimizeIncludes"))
+        m_minimizeIncludes = config["minimizeIncludes"].get<bool>();
+
+    if (config.contains("includeReport"))
+        m_includeReport = config["includeReport"].get<bool>();
+
+    if (config.contains("optimizeMemberLayout"))
+        m_optimizeMemberLayout = config["optimizeMemberLayout"].get<bool>();
+
+    if (config.contains("groupByVisibility"))
+        m_groupByVisibility = config["groupByVisibility"].get<bool>();
+
+    if (config.contains("specialMembers"))
+        m_specialMembers = config["specialMembers"].get<bool>();
+
+    if (config.contains("finalClasses"))
+        m_finalClasses = config["finalClasses"].get<bool>();
+
+    if (config.contains("memberReflection"))
+        m_memberReflection = config["memberReflection"].get<bool>();
+
+    if (config.contains("equalityAndHash"))
+        m_equalityAndHash = config["equalityAndHash"].get<bool>();
+
+    if (config.contains("enumReflection"))
+        m_enumReflection = config["enumReflection"].get<bool>();
+
+    if (config.contains("enumUnderlyingType"))
+        m_enumUnderlyingType = config["enumUnderlyingType"].get<std::string>();
+
+    if (config.contains("variantDispatch"))
+        m_variantDispatch = config["variantDispatch"].get<bool>();
+
+    if (config.contains("compactVariants"))
+        m_compactVariants = config["compactVariants"].get<bool>();
+
+    if (config.contains("wireFormat"))
+        m_wireFormat = config["wireFormat"].get<bool>();
+
+    if (config.contains("classHeaderTemplate"))
+        m_classHeaderTemplate = config["classHeaderTemplate"].get<std::string>();
+
+    if (config.contains("enumHeaderTemplate"))
+        m_enumHeaderTemplate = config["enumHeaderTemplate"].get<std::string>();
+
+    if (config.contains("variantHeaderTemplate"))
+        m_variantHeaderTemplate = config["variantHeaderTemplate"].get<std::string>();
+
     if (config.contains("containerByCardinalityComposition"))
         m_containerByCardinalityComposition =
             config["containerByCardinalityComposition"].get<std::unordered_map<std::string, std::string>>();
@@ -204,14 +509,55 @@ void Config::readConfigFrom(std::filesystem::path configFilePath)
         m_containerByCardinalityAggregation =
             config["containerByCardinalityAggregation"].get<std::unordered_map<std::string, std::string>>();
 
+    if (config.contains("boundedContainer"))
+        m_boundedContainer = config["boundedContainer"].get<std::string>();
+
+    if (config.contains("maxInlineCapacity"))
+        m_maxInlineCapacity = config["maxInlineCapacity"].get<size_t>();
+
+    if (config.contains("aggregationPolicy"))
+        m_aggregationPolicy = config["aggregationPolicy"].get<std::string>();
+
+    if (config.contains("aggregationPolicyByStereotype"))
+        m_aggregationPolicyByStereotype =
+            config["aggregationPolicyByStereotype"].get<std::unordered_map<std::string, std::string>>();
+
+    if (config.contains("specialMembersStereotypes"))
+        m_specialMembersStereotypes = config["specialMembersStereotypes"].get<std::unordered_set<std::string>>();
+
+    if (config.contains("nonCopyableTypes"))
+        m_nonCopyableTypes = config["nonCopyableTypes"].get<std::unordered_set<std::string>>();
+
+    if (config.contains("nonMovableTypes"))
+        m_nonMovableTypes = config["nonMovableTypes"].get<std::unordered_set<std::string>>();
+
+    if (config.contains("throwingMoveTypes"))
+        m_throwingMoveTypes = config["throwingMoveTypes"].get<std::unordered_set<std::string>>();
+
+    if (config.contains("triviallyCopyableTypes"))
+        m_triviallyCopyableTypes = config["triviallyCopyableTypes"].get<std::unordered_set<std::string>>();
+
+    if (config.contains("wireScalarTypes"))
+        m_wireScalarTypes = config["wireScalarTypes"].get<std::unordered_set<std::string>>();
+
     if (config.contains("typeToIncludeMap"))
         m_typeToIncludeMap = config["typeToIncludeMap"].get<std::unordered_map<std::string, std::string>>();
 
     if (config.contains("umlToCppTypeMap"))
         m_umlToCppTypeMap = config["umlToCppTypeMap"].get<std::unordered_map<std::string, std::string>>();
+
+    if (config.contains("typeLayouts"))
+        m_typeLayouts = config["typeLayouts"].get<std::unordered_map<std::string, std::array<size_t, 2>>>();
 }
 
 void Config::writeConfigTo(std::filesystem::path configFilePath)
+{
+    std::ofstream o(configFilePath);
+    o << settings(4) << std::endl;
+    o.close();
+}
+
+std::string Config::settings(int indent) const
 {
     json config;
 
@@ -227,13 +573,40 @@ void Config::writeConfigTo(std::filesystem::path configFilePath)
 
     config["memberPrefixForStructs"] = m_memberPrefixForStructs;
     config["concatenateNamespaces"]  = m_concatenateNamespaces;
+    config["forwardDeclarations"]    = m_forwardDeclarations;
+    config["minimizeIncludes"]       = m_minimizeIncludes;
+    config["includeReport"]          = m_includeReport;
+    config["optimizeMemberLayout"]   = m_optimizeMemberLayout;
+    config["groupByVisibility"]      = m_groupByVisibility;
+    config["specialMembers"]         = m_specialMembers;
+    config["finalClasses"]           = m_finalClasses;
+    config["memberReflection"]       = m_memberReflection;
+    config["equalityAndHash"]        = m_equalityAndHash;
+    config["enumReflection"]         = m_enumReflection;
+    config["enumUnderlyingType"]     = m_enumUnderlyingType;
+    config["variantDispatch"]        = m_variantDispatch;
+    config["compactVariants"]        = m_compactVariants;
+    config["wireFormat"]             = m_wireFormat;
+
+    config["classHeaderTemplate"]   = m_classHeaderTemplate;
+    config["enumHeaderTemplate"]    = m_enumHeaderTemplate;
+    config["variantHeaderTemplate"] = m_variantHeaderTemplate;
 
     config["containerByCardinalityComposition"] = m_containerByCardinalityComposition;
     config["containerByCardinalityAggregation"] = m_containerByCardinalityAggregation;
+    config["boundedContainer"]                  = m_boundedContainer;
+    config["maxInlineCapacity"]                 = m_maxInlineCapacity;
+    config["aggregationPolicy"]                 = m_aggregationPolicy;
+    config["aggregationPolicyByStereotype"]     = m_aggregationPolicyByStereotype;
+    config["specialMembersStereotypes"]         = m_specialMembersStereotypes;
+    config["nonCopyableTypes"]                  = m_nonCopyableTypes;
+    config["nonMovableTypes"]                   = m_nonMovableTypes;
+    config["throwingMoveTypes"]                 = m_throwingMoveTypes;
+    config["triviallyCopyableTypes"]            = m_triviallyCopyableTypes;
+    config["wireScalarTypes"]                   = m_wireScalarTypes;
     config["typeToIncludeMap"]                  = m_typeToIncludeMap;
     config["umlToCppTypeMap"]                   = m_umlToCppTypeMap;
+    config["typeLayouts"]                       = m_typeLayouts;
 
-    std::ofstream o(configFilePath);
-    o << std::setw(4) << config << std::endl;
-    o.close();
+    return config.dump(indent);
 }
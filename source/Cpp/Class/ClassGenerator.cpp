@@ -1,8 +1,16 @@
 #include "Cpp/Class/ClassGenerator.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <numeric>
+#include <thread>
+
+#include "Cpp/Enum/Translator.h"
 
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -10,12 +18,60 @@ namespace fs = std::filesystem;
 namespace Cpp {
 namespace Class {
 
-ClassGenerator::ClassGenerator(std::shared_ptr<Config> config)
+namespace {
+
+// rendering a class takes microseconds, below this many classes per thread starting threads doesn't pay off
+constexpr size_t minClassesPerThread = 32;
+
+} // namespace
+
+ClassGenerator::ClassGenerator(std::shared_ptr<Config> config,
+                               std::shared_ptr<Common::TypeRenderer> typeRenderer,
+                               size_t maxThreads)
     : m_config(std::move(config))
+    , m_maxThreads(maxThreads == 0 ? std::thread::hardware_concurrency() : maxThreads)
     , m_postProcessor(m_config)
-    , m_headerGenerator(m_config)
-    , m_sourceGenerator(m_config)
+    , m_headerGenerator(m_config, typeRenderer)
+    , m_sourceGenerator(m_config, typeRenderer)
+    , m_supportHeaders(m_config)
+    , m_wireFormat(m_config, typeRenderer)
+{
+}
+
+void ClassGenerator::prepare(const std::vector<const PlantUml::SyntaxNode*>& models)
 {
+    std::vector<Translator> translators;
+    translators.reserve(models.size());
+    for (const auto* model : models) {
+        model->visit(translators.emplace_back(m_config));
+    }
+
+    // a model may compose many elements of a struct-of-arrays type of another model
+    m_companions.clear();
+    for (const auto& translator : translators) {
+        translator.indexCompanions(m_companions);
+    }
+
+    std::vector<Class> classes;
+    for (auto& translator : translators) {
+        auto modelClasses = std::move(translator).results(m_companions);
+        std::move(modelClasses.begin(), modelClasses.end(), std::back_inserter(classes));
+    }
+
+    // a struct may contain structs and enums of another model
+    std::vector<Enum::Enum> enums;
+    if (needsEnums()) {
+        for (const auto* model : models) {
+            Enum::Translator enumTranslator(m_config);
+            model->visit(enumTranslator);
+            auto modelEnums = std::move(enumTranslator).results();
+            std::move(modelEnums.begin(), modelEnums.end(), std::back_inserter(enums));
+        }
+    }
+    m_wireFormat.index(classes, enums);
+
+    m_postProcessor.index(std::move(classes), enums);
+    m_generatedSupportHeaders.clear();
 }
 
 std::vector<File> ClassGenerator::generate(PlantUml::SyntaxNode root)
@@ -24,31 +80,93 @@ std::vector<File> ClassGenerator::generate(PlantUml::SyntaxNode root)
 
     Translator translator(m_config);
     root.visit(translator);
-    auto classes = std::move(translator).results();
+    auto classes = std::move(translator).results(m_companions);
+
+    // whether a member is written as a scalar or has a hash depends on whether its type is an enum of the model
+    std::vector<Enum::Enum> enums;
+    if (needsEnums()) {
+        Enum::Translator enumTranslator(m_config);
+        root.visit(enumTranslator);
+        enums = std::move(enumTranslator).results();
+    }
+
+    m_postProcessor.process(classes, enums);
+    m_wireFormat.select(classes, enums);
+
+    // every class owns the slots 2i (header) and 2i+1 (source), so the order doesn't depend on the scheduling
+    files.resize(2 * classes.size());
 
-    m_postProcessor.process(classes);
+    std::atomic<size_t> next = 0;
+
+    // an exception escaping a thread would terminate the process, so the first one is rethrown on this thread
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    auto worker = [&]() {
+        try {
+            for (size_t i = next++; i < classes.size(); i = next++) {
+                render(classes[i], files[2 * i], files[2 * i + 1]);
+            }
+        } catch (...) {
+            // the other threads stop after their current class
+            next = classes.size();
+            std::lock_guard lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    {
+        size_t threadCount = std::min(m_maxThreads, classes.size() / minClassesPerThread);
+
+        std::vector<std::jthread> helpers;
+        for (size_t i = 1; i < threadCount; ++i) {
+            helpers.emplace_back(worker);
+        }
+        worker();
+    } // helpers join here
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
 
     for (const auto& c : classes) {
-        auto nsPath =
-            std::accumulate(c.namespaces.begin(), c.namespaces.end(), fs::path(), [](const auto& a, const auto& b) {
-                return fs::path(a) / fs::path(b);
-            });
-
-        File header;
-        header.content = m_headerGenerator.generate(c);
-        header.path    = m_config->headersPath() / nsPath / (c.name + "." + m_config->headerFileExtention());
-        files.emplace_back(std::move(header));
-
-        File source;
-        source.content = m_sourceGenerator.generate(c);
-        if (!source.content.empty()) {
-            source.path = m_config->sourcesPath() / nsPath / (c.name + "." + m_config->sourceFileExtention());
+        if (c.hasWireFormat) {
+            files.push_back(m_wireFormat.generate(c));
+        }
+    }
+
+    // support headers are shared by all models, so only the first model that needs one gets it
+    for (auto& support : m_supportHeaders.generate(classes)) {
+        if (m_generatedSupportHeaders.insert(support.path).second) {
+            files.push_back(std::move(support));
         }
-        files.emplace_back(std::move(source));
     }
 
     return files;
 }
 
+void ClassGenerator::render(const Class& c, File& header, File& source)
+{
+    auto nsPath =
+        std::accumulate(c.namespaces.begin(), c.namespaces.end(), fs::path(), [](const auto& a, const auto& b) {
+            return fs::path(a) / fs::path(b);
+        });
+
+    header.content = m_headerGenerator.generate(c);
+    header.path    = m_config->headersPath() / nsPath / (c.name + "." + m_config->headerFileExtention());
+
+    source.content = m_sourceGenerator.generate(c);
+    if (!source.content.empty()) {
+        source.path = m_config->sourcesPath() / nsPath / (c.name + "." + m_config->sourceFileExtention());
+    }
+}
+
+bool ClassGenerator::needsEnums() const
+{
+    return m_config->wireFormat() || m_config->equalityAndHash();
+}
+
 } // namespace Class
 } // namespace Cpp
@@ -0,0 +1,239 @@
+#include "Cpp/Class/EqualityAndHash.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include "Cpp/Class/SupportHeaders.h"
+
+namespace Cpp::Class {
+
+namespace {
+
+// builtin types and std types with a std::hash, whatever their arguments
+constexpr std::array<std::string_view, 49> hashedTypes = {"bool",
+                                                          "char",
+                                                          "signed char",
+                                                          "unsigned char",
+                                                          "char8_t",
+                                                          "char16_t",
+                                                          "char32_t",
+                                                          "wchar_t",
+                                                          "short",
+                                                          "unsigned short",
+                                                          "int",
+                                                          "unsigned",
+                                                          "unsigned int",
+                                                          "uint",
+                                                          "long",
+                                                          "unsigned long",
+                                                          "long long",
+                                                          "unsigned long long",
+                                                          "float",
+                                                          "double",
+                                                          "long double",
+                                                          "size_t",
+                                                          "std::size_t",
+                                                          "std::ptrdiff_t",
+                                                          "std::byte",
+                                                          "std::int8_t",
+                                                          "std::uint8_t",
+                                                          "std::int16_t",
+                                                          "std::uint16_t",
+                                                          "std::int32_t",
+                                                          "std::uint32_t",
+                                                          "std::int64_t",
+                                                          "std::uint64_t",
+                                                          "std::nullptr_t",
+                                                          "std::string",
+                                                          "std::wstring",
+                                                          "std::u8string",
+                                                          "std::u16string",
+                                                          "std::u32string",
+                                                          "std::string_view",
+                                                          "std::bitset",
+                                                          "std::monostate",
+                                                          "std::type_index",
+                                                          "std::error_code",
+                                                          "std::error_condition",
+                                                          "std::thread::id",
+                                                          "std::filesystem::path",
+                                                          "std::unique_ptr",
+                                                          "std::shared_ptr"};
+
+// Hash::combine hashes these element by element, so they have a hash if their arguments have one
+constexpr std::array<std::string_view, 20> elementTemplates = {"std::optional",
+                                                               "std::variant",
+                                                               "std::pair",
+                                                               "std::tuple",
+                                                               "std::array",
+                                                               "std::span",
+                                                               "std::vector",
+                                                               "std::deque",
+                                                               "std::list",
+                                                               "std::forward_list",
+                                                               "std::set",
+                                                               "std::multiset",
+                                                               "std::map",
+                                                               "std::multimap",
+                                                               "std::unordered_set",
+                                                               "std::unordered_multiset",
+                                                               "std::unordered_map",
+                                                               "std::unordered_multimap",
+                                                               "boost::container::static_vector",
+                                                               "boost::container::small_vector"};
+
+// a struct the defaulted operator== compares as a value
+bool isValueType(const Class& c)
+{
+    if (!c.isStruct || c.isInterface || !c.inherits.empty()) {
+        return false;
+    }
+    return std::ranges::none_of(c.body, [](const ClassElement& elem) {
+        const auto* method = std::get_if<Method>(&elem);
+        const auto* var    = std::get_if<Variable>(&elem);
+        return (method != nullptr && method->isAbstract) ||
+               (var != nullptr && !var->isStatic && var->type.base.ends_with('&'));
+    });
+}
+
+} // namespace
+
+EqualityAndHash::EqualityAndHash(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
+void EqualityAndHash::index(const std::vector<Class>& classes, const std::vector<Enum::Enum>& enums)
+{
+    m_project.clear();
+    if (!m_config->equalityAndHash()) {
+        return;
+    }
+
+    indexTypes(classes, enums);
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_project.add(classes[i].namespaces, classes[i].name, hashable(classes, i));
+    }
+    for (const auto& e : enums) {
+        m_project.add(e.namespaces, e.name, true);
+    }
+}
+
+void EqualityAndHash::add(std::vector<Class>& classes, const std::vector<Enum::Enum>& enums)
+{
+    if (!m_config->equalityAndHash()) {
+        return;
+    }
+
+    // whether a struct has a hash depends on the structs it contains, so all of them are judged before any changes
+    indexTypes(classes, enums);
+    for (size_t i = 0; i < classes.size(); ++i) {
+        hashable(classes, i);
+    }
+
+    for (size_t i = 0; i < classes.size(); ++i) {
+        auto& c = classes[i];
+        if (!isValueType(c)) {
+            continue;
+        }
+
+        bool isPublic       = true;
+        bool hasPrivateData = false;
+        for (const auto& elem : c.body) {
+            if (const auto* keyword = std::get_if<VisibilityKeyword>(&elem)) {
+                isPublic = keyword->name == "public:";
+            } else if (const auto* var = std::get_if<Variable>(&elem); var != nullptr && !var->isStatic) {
+                hasPrivateData |= !isPublic;
+            }
+        }
+
+        const auto& indent = m_config->indent();
+        if (!c.body.empty()) {
+            c.body.emplace_back("");
+        }
+        if (!isPublic) {
+            c.body.emplace_back(VisibilityKeyword{"public:"});
+        }
+        c.body.emplace_back(indent + "bool operator==(const " + c.name + "&) const = default;");
+        if (!m_hashable[i]) {
+            continue;
+        }
+
+        // the hash reads the members directly
+        if (hasPrivateData) {
+            c.body.emplace_back(indent + "friend struct std::hash<" + c.name + ">;");
+        }
+        c.isHashable = true;
+        c.localIncludes.insert(SupportHeaders::include("Hash", *m_config));
+    }
+}
+
+void EqualityAndHash::indexTypes(const std::vector<Class>& classes, const std::vector<Enum::Enum>& enums)
+{
+    m_classIndex.clear();
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_classIndex.add(classes[i].namespaces, classes[i].name, i);
+    }
+    m_enums.clear();
+    for (const auto& e : enums) {
+        m_enums.add(e.namespaces, e.name, true);
+    }
+    m_states.assign(classes.size(), Common::VisitState::Pending);
+    m_hashable.assign(classes.size(), false);
+}
+
+bool EqualityAndHash::hashable(const std::vector<Class>& classes, size_t index)
+{
+    // a struct can only contain itself through a pointer or a container, which doesn't restrict it
+    if (m_states[index] == Common::VisitState::InProgress) {
+        return true;
+    }
+    if (m_states[index] == Common::VisitState::Done) {
+        return m_hashable[index];
+    }
+    m_states[index] = Common::VisitState::InProgress;
+
+    const auto& c = classes[index];
+    bool result   = isValueType(c);
+    for (const auto& elem : c.body) {
+        if (const auto* var = std::get_if<Variable>(&elem); result && var != nullptr && !var->isStatic) {
+            result = hashable(classes, c, var->type);
+        }
+    }
+
+    m_states[index]   = Common::VisitState::Done;
+    m_hashable[index] = result;
+    return result;
+}
+
+bool EqualityAndHash::hashable(const std::vector<Class>& classes, const Class& scope, const Common::Type& type)
+{
+    const auto& base = type.base;
+    // std::hash of pointers hashes the address, the size of a std::array has no hash to check
+    if (base.ends_with('*') || (!base.empty() && std::isdigit(static_cast<unsigned char>(base.front())))) {
+        return true;
+    }
+    if (std::ranges::find(hashedTypes, base) != hashedTypes.end()) {
+        return true;
+    }
+    if (std::ranges::find(elementTemplates, base) != elementTemplates.end()) {
+        return std::ranges::all_of(type.templateParams,
+                                   [&](const Common::Type& param) { return hashable(classes, scope, param); });
+    }
+
+    if (const auto* other = m_classIndex.find(scope.namespaces, base)) {
+        return hashable(classes, *other);
+    }
+    if (m_enums.find(scope.namespaces, base) != nullptr) {
+        return true;
+    }
+    const auto* known = m_project.find(scope.namespaces, base);
+    return known != nullptr && *known;
+}
+
+} // namespace Cpp::Class
@@ -0,0 +1,152 @@
+#include "Cpp/Class/FinalSpecifiers.h"
+
+#include <algorithm>
+#include <utility>
+#include <variant>
+
+namespace Cpp::Class {
+
+namespace {
+
+bool isAbstract(const Class& c)
+{
+    return c.isInterface || std::ranges::any_of(c.body, [](const ClassElement& elem) {
+               return std::holds_alternative<Method>(elem) && std::get<Method>(elem).isAbstract;
+           });
+}
+
+bool sameSignature(const Method& l, const Method& r)
+{
+    return l.name == r.name && l.isConst == r.isConst &&
+           std::ranges::equal(l.parameters, r.parameters, [](const Parameter& a, const Parameter& b) {
+               return a.type == b.type;
+           });
+}
+
+} // namespace
+
+FinalSpecifiers::FinalSpecifiers(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
+void FinalSpecifiers::index(const std::vector<Class>& classes)
+{
+    m_project.clear();
+    if (!m_config->finalClasses()) {
+        return;
+    }
+
+    indexClasses(classes);
+    auto derived = derivedClasses(classes);
+
+    for (size_t i = 0; i < classes.size(); ++i) {
+        std::vector<bool> visited(classes.size(), false);
+        std::vector<const Method*> abstractMethods;
+        for (const auto& elem : classes[i].body) {
+            if (auto* method = std::get_if<Method>(&elem); method && method->isAbstract) {
+                abstractMethods.push_back(method);
+            }
+        }
+        collectAbstractMethods(classes, i, visited, abstractMethods);
+
+        Hierarchy hierarchy{derived[i], {}};
+        for (const auto* method : abstractMethods) {
+            hierarchy.abstractMethods.push_back(*method);
+        }
+        m_project.add(classes[i].namespaces, classes[i].name, std::move(hierarchy));
+    }
+}
+
+void FinalSpecifiers::add(std::vector<Class>& classes)
+{
+    if (!m_config->finalClasses()) {
+        return;
+    }
+
+    // all bases have to be known before any class is a leaf
+    indexClasses(classes);
+    auto derived = derivedClasses(classes);
+    std::vector<bool> derives(classes.size(), false);
+    for (size_t i = 0; i < classes.size(); ++i) {
+        const auto& c = classes[i];
+        if (const auto* hierarchy = m_project.at(c.namespaces, c.name); hierarchy && hierarchy->derived) {
+            derived[i] = true;
+        }
+        derives[i] = std::ranges::any_of(c.inherits, [this, &c](const std::string& base) {
+            return m_classIndex.find(c.namespaces, base) || m_project.find(c.namespaces, base);
+        });
+    }
+
+    for (size_t i = 0; i < classes.size(); ++i) {
+        auto& c = classes[i];
+        if (!derives[i] || derived[i] || isAbstract(c)) {
+            continue;
+        }
+        c.isFinal = true;
+
+        std::vector<bool> visited(classes.size(), false);
+        std::vector<const Method*> abstractMethods;
+        collectAbstractMethods(classes, i, visited, abstractMethods);
+
+        for (auto& elem : c.body) {
+            if (auto* method = std::get_if<Method>(&elem); method && !method->isStatic) {
+                method->isFinal = std::ranges::any_of(
+                    abstractMethods, [method](const Method* other) { return sameSignature(*method, *other); });
+            }
+        }
+    }
+}
+
+void FinalSpecifiers::indexClasses(const std::vector<Class>& classes)
+{
+    m_classIndex.clear();
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_classIndex.add(classes[i].namespaces, classes[i].name, i);
+    }
+}
+
+std::vector<bool> FinalSpecifiers::derivedClasses(const std::vector<Class>& classes) const
+{
+    std::vector<bool> derived(classes.size(), false);
+    for (const auto& c : classes) {
+        for (const auto& base : c.inherits) {
+            if (const auto* index = m_classIndex.find(c.namespaces, base)) {
+                derived[*index] = true;
+            }
+        }
+    }
+    return derived;
+}
+
+void FinalSpecifiers::collectAbstractMethods(const std::vector<Class>& classes,
+                                             size_t index,
+                                             std::vector<bool>& visited,
+                                             std::vector<const Method*>& methods) const
+{
+    for (const auto& base : classes[index].inherits) {
+        // a base of another model brings all its abstract methods along
+        const auto* other = m_classIndex.find(classes[index].namespaces, base);
+        if (!other) {
+            if (const auto* hierarchy = m_project.find(classes[index].namespaces, base)) {
+                for (const auto& method : hierarchy->abstractMethods) {
+                    methods.push_back(&method);
+                }
+            }
+            continue;
+        }
+        if (visited[*other]) {
+            continue;
+        }
+        visited[*other] = true;
+
+        for (const auto& elem : classes[*other].body) {
+            if (auto* method = std::get_if<Method>(&elem); method && method->isAbstract) {
+                methods.push_back(method);
+            }
+        }
+        collectAbstractMethods(classes, *other, visited, methods);
+    }
+}
+
+} // namespace Cpp::Class
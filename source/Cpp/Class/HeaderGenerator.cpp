@@ -1,156 +1,244 @@
 #include "Cpp/Class/HeaderGenerator.h"
 
-#include <algorithm>
-#include <cctype>
-#include <concepts>
 #include <list>
-#include <numeric>
-#include <ranges>
+#include <map>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace Cpp::Class {
 
-// template <typename T>
-// concept HasVisibility = requires(T a)
-//{
-//    std::same_as<Visibility, decltype(a.visibility)>;
-//};
+namespace {
 
-// template <HasVisibility T>
-// auto filterOnVisibility(Visibility vis)
-//{
-//    return std::views::filter([vis](const T& m) { return m.visibility == vis; });
-//}
-
-HeaderGenerator::HeaderGenerator(std::shared_ptr<Config> config)
+enum class Placeholder
+{
+    Name,
+    Comment,
+    Includes,
+    ForwardDeclarations,
+    NamespacesOpen,
+    NamespacesClose,
+    Definition,
+    Body,
+    Hash
+};
+
+const std::vector<std::string_view> placeholders = {"name",
+                                                    "comment",
+                                                    "includes",
+                                                    "forwardDeclarations",
+                                                    "namespacesOpen",
+                                                    "namespacesClose",
+                                                    "definition",
+                                                    "body",
+                                                    "hash"};
+
+constexpr std::string_view builtInLayout = "#pragma once\n\n"
+                                           "{{includes}}\n"
+                                           "{{forwardDeclarations}}"
+                                           "{{namespacesOpen}}"
+                                           "{{definition}}\n{\n{{body}}};\n"
+                                           "{{namespacesClose}}"
+                                           "{{hash}}";
+
+} // namespace
+
+HeaderGenerator::HeaderGenerator(std::shared_ptr<Config> config,
+                                 std::shared_ptr<Common::TypeRenderer> typeRenderer)
     : m_config(std::move(config))
     , m_genUtils(m_config)
+    , m_typeRenderer(std::move(typeRenderer))
+    , m_template(Common::CodeTemplate::fromFile(m_config->classHeaderTemplate(), builtInLayout, placeholders))
 {
 }
 
 std::string HeaderGenerator::generate(const Class& in)
 {
-    // setup
-    m_variablePrefix = in.isStruct && m_config->noMemberPrefixForStructs() ? "" : m_config->memberPrefix();
-
-    std::string ret;
-
-    // pragme once
-    ret += "#pragma once\n\n";
-
-    // Includes
-    ret += generateIncludes(in);
+    // rough estimate of the output size to avoid growing the buffer over and over
+    Common::CodeEmitter out(m_template.literalSize() + 128 +
+                            32 * (in.externalIncludes.size() + in.localIncludes.size()) + 64 * in.body.size());
+
+    m_template.render(out, [this, &in](Common::CodeEmitter& o, size_t placeholder) {
+        switch (static_cast<Placeholder>(placeholder)) {
+        case Placeholder::Name:
+            o << in.name;
+            break;
+        case Placeholder::Comment:
+            o << in.comment;
+            break;
+        case Placeholder::Includes:
+            generateIncludes(o, in);
+            break;
+        case Placeholder::ForwardDeclarations:
+            generateForwardDeclarations(o, in);
+            break;
+        case Placeholder::NamespacesOpen:
+            m_genUtils.openNamespaces(o, in.namespaces);
+            break;
+        case Placeholder::NamespacesClose:
+            m_genUtils.closeNamespaces(o, in.namespaces);
+            break;
+        case Placeholder::Definition:
+            generateDefinition(o, in);
+            break;
+        case Placeholder::Body:
+            generateBody(o, in);
+            break;
+        case Placeholder::Hash:
+            generateHash(o, in);
+            break;
+        }
+    });
+
+    // the struct befriends and includes the hash, so it has to be there even if the template forgot it
+    if (!m_template.contains(static_cast<size_t>(Placeholder::Hash))) {
+        generateHash(out, in);
+    }
 
-    ret += "\n";
+    return out.str();
+}
 
-    // open namespaces
-    ret += m_genUtils.openNamespaces(in.namespaces);
+void HeaderGenerator::generateForwardDeclarations(Common::CodeEmitter& out, const Class& in)
+{
+    // group the declarations by namespace, so each namespace is opened once
+    std::map<std::list<std::string>, std::vector<std::pair<std::string_view, bool>>> declarations;
+    for (const auto& declaration : in.forwardDeclarations) {
+        std::string_view type = declaration.name;
+        std::list<std::string> namespaces;
+        for (auto pos = type.find("::"); pos != std::string_view::npos; pos = type.find("::")) {
+            namespaces.emplace_back(type.substr(0, pos));
+            type.remove_prefix(pos + 2);
+        }
+        declarations[namespaces].emplace_back(type, declaration.isStruct);
+    }
 
-    // Definintion
-    std::string classDef = "class";
-    if (in.isStruct) {
-        classDef = "struct";
+    // the class-key has to match the definition
+    for (const auto& [namespaces, names] : declarations) {
+        m_genUtils.openNamespaces(out, namespaces);
+        for (const auto& [name, isStruct] : names) {
+            out << (isStruct ? "struct " : "class ") << name << ";\n";
+        }
+        m_genUtils.closeNamespaces(out, namespaces);
+        out << "\n";
     }
+}
 
-    classDef += " " + in.name;
+void HeaderGenerator::generateDefinition(Common::CodeEmitter& out, const Class& in)
+{
+    out << (in.isStruct ? "struct " : "class ") << in.name;
+    if (in.isFinal) {
+        out << " final";
+    }
 
     if (!in.inherits.empty()) {
-        classDef += " : public ";
-        classDef = std::accumulate(
-            in.inherits.begin(), in.inherits.end(), classDef, [](const std::string& acc, const std::string& parent) {
-                return acc + parent + ", ";
-            });
-        classDef.erase(classDef.length() - 2);
+        out << " : public ";
+        out.join(in.inherits, ", ", [](Common::CodeEmitter& o, const std::string& parent) { o << parent; });
+    }
+}
+
+void HeaderGenerator::generateBody(Common::CodeEmitter& out, const Class& in)
+{
+    std::string_view variablePrefix;
+    if (!in.isStruct || !m_config->noMemberPrefixForStructs()) {
+        variablePrefix = m_config->memberPrefix();
     }
-    ret += classDef + "\n{\n";
 
-    // Body
     for (const auto& elem : in.body) {
-        ret += std::visit([this](auto&& arg) -> std::string { return toString(arg); }, elem);
-        ret += "\n";
+        std::visit(
+            [this, &out, variablePrefix](auto&& arg) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, Variable>) {
+                    emit(out, arg, variablePrefix);
+                } else {
+                    emit(out, arg);
+                }
+            },
+            elem);
+        out << "\n";
     }
+}
 
-    ret += "};\n";
+void HeaderGenerator::generateHash(Common::CodeEmitter& out, const Class& in)
+{
+    if (!in.isHashable) {
+        return;
+    }
+
+    std::string name;
+    for (const auto& ns : in.namespaces) {
+        name += ns + "::";
+    }
+    name += in.name;
 
-    // close namespaces
-    ret += m_genUtils.closeNamespaces(in.namespaces);
+    std::string_view variablePrefix;
+    if (!m_config->noMemberPrefixForStructs()) {
+        variablePrefix = m_config->memberPrefix();
+    }
 
-    return ret;
+    const auto& indent = m_config->indent();
+    out << "\ntemplate <>\nstruct std::hash<" << name << ">\n{\n";
+    out << indent << "std::size_t operator()(const " << name << "& value) const noexcept\n";
+    out << indent << "{\n";
+    out << indent << indent << "std::size_t seed = 0;\n";
+    for (const auto& elem : in.body) {
+        if (const auto* var = std::get_if<Variable>(&elem); var != nullptr && !var->isStatic) {
+            out << indent << indent << "Hash::combine(seed, value." << variablePrefix << var->name << ");\n";
+        }
+    }
+    out << indent << indent << "return seed;\n";
+    out << indent << "}\n};\n";
 }
 
-std::string HeaderGenerator::generateIncludes(const Class& in)
+void HeaderGenerator::generateIncludes(Common::CodeEmitter& out, const Class& in)
 {
-    auto libIncludeStrings =
-        in.externalIncludes | std::views::transform([](const std::string& inc) { return "#include <" + inc + ">\n"; });
-    std::string libIncs = std::accumulate(libIncludeStrings.begin(), libIncludeStrings.end(), std::string());
-
-    auto localIncludeStrings =
-        in.localIncludes | std::views::transform([](const std::string& inc) { return "#include \"" + inc + "\"\n"; });
-    std::string localIncs = std::accumulate(localIncludeStrings.begin(), localIncludeStrings.end(), std::string());
+    for (const auto& inc : in.externalIncludes) {
+        out << "#include <" << inc << ">\n";
+    }
 
-    if (!libIncs.empty() && !localIncs.empty()) {
-        libIncs += "\n";
+    if (!in.externalIncludes.empty() && !in.localIncludes.empty()) {
+        out << "\n";
     }
 
-    return libIncs + localIncs;
+    for (const auto& inc : in.localIncludes) {
+        out << "#include \"" << inc << "\"\n";
+    }
 }
 
-std::string HeaderGenerator::toString(const std::string& s)
+void HeaderGenerator::emit(Common::CodeEmitter& out, const std::string& s)
 {
-    return s;
+    out << s;
 }
 
-std::string HeaderGenerator::toString(const Variable& var)
+void HeaderGenerator::emit(Common::CodeEmitter& out, const Variable& var, std::string_view variablePrefix)
 {
-    std::string varName = m_variablePrefix + var.name;
-    return m_config->indent() + typeToString(var.type) + " " + varName + ";";
+    out << m_config->indent() << m_typeRenderer->render(var.type) << " " << variablePrefix << var.name << ";";
 }
 
-std::string HeaderGenerator::toString(const Method& m)
+void HeaderGenerator::emit(Common::CodeEmitter& out, const Method& m)
 {
-    std::string ret = m_config->indent();
+    out << m_config->indent();
     if (m.isAbstract) {
-        ret += "virtual ";
-    }
-    ret += typeToString(m.returnType) + " " + m.name + "(";
-    if (!m.parameters.empty()) {
-        ret += std::accumulate(m.parameters.begin(),
-                               m.parameters.end(),
-                               std::string(),
-                               [this](const std::string& acc, const Parameter& param) {
-                                   return acc + typeToString(param.type) + " " + param.name + ", ";
-                               });
-        ret.erase(ret.length() - 2);
+        out << "virtual ";
     }
+    out << m_typeRenderer->render(m.returnType) << " " << m.name << "(";
+    out.join(m.parameters, ", ", [this](Common::CodeEmitter& o, const Parameter& param) {
+        o << m_typeRenderer->render(param.type) << " " << param.name;
+    });
     if (m.isAbstract) {
-        return ret + ") = 0;";
+        out << ") = 0;";
+    } else {
+        out << (m.isFinal ? ") final;" : ");");
     }
-    return ret + ");";
-}
-
-std::string HeaderGenerator::toString(const VisibilityKeyword& s)
-{
-    return s.name;
 }
 
-std::string HeaderGenerator::toString(const Separator& s)
+void HeaderGenerator::emit(Common::CodeEmitter& out, const VisibilityKeyword& s)
 {
-    return "// " + s.text;
+    out << s.name;
 }
 
-std::string HeaderGenerator::typeToString(const Common::Type& t)
+void HeaderGenerator::emit(Common::CodeEmitter& out, const Separator& s)
 {
-    std::string templ;
-    for (const auto& param : t.templateParams) {
-        templ += typeToString(param) + ", ";
-    }
-    if (!t.templateParams.empty()) {
-        templ.erase(templ.length() - 2);
-        templ = "<" + templ + ">";
-    }
-
-    return t.base + templ;
+    out << "// " << s.text;
 }
 
 } // namespace Cpp::Class
@@ -1,73 +1,144 @@
 #include "Cpp/Class/IncludeGatherer.h"
 
 #include <algorithm>
-#include <numeric>
+#include <array>
+#include <cctype>
+#include <string_view>
 #include <utility>
 #include <variant>
 
+#include "Cpp/Class/SupportHeaders.h"
+
 namespace Cpp::Class {
 
+namespace {
+
+constexpr std::array<std::string_view, 7> builtInTypes = {
+    "void", "bool", "int", "float", "double", "uint", "unsigned int"};
+
+// templates that can be instantiated with an incomplete type
+constexpr std::array<std::string_view, 3> indirectionTemplates = {"std::shared_ptr", "std::weak_ptr", "Handle"};
+
+// pointers and references only need a declaration of the type
+bool stripIndirection(std::string& type)
+{
+    auto end = type.find_last_not_of("*& ");
+    if (end == std::string::npos || end + 1 == type.size()) {
+        return false;
+    }
+    type.erase(end + 1);
+    return true;
+}
+
+} // namespace
+
 IncludeGatherer::IncludeGatherer(std::shared_ptr<Config> config)
     : m_config(std::move(config))
 {
 }
 
+void IncludeGatherer::index(const std::vector<Class>& classes)
+{
+    m_declarations.clear();
+    for (const auto& c : classes) {
+        m_declarations.add(c.namespaces, c.name, {Common::qualifiedName(c.namespaces, c.name), c.isStruct});
+    }
+}
+
 void IncludeGatherer::gather(Class& c)
 {
-    // record all used types
-    std::set<std::string> usedTypes;
+    // record all used types, split by whether the header needs the complete type or a declaration is enough
+    std::set<std::string> completeTypes;
+    std::set<std::string> declaredTypes;
     for (const auto& p : c.inherits) {
-        usedTypes.insert(p);
+        completeTypes.insert(p);
     }
     for (const auto& v : c.body) {
         if (std::holds_alternative<Variable>(v)) {
-            auto var    = std::get<Variable>(v);
-            auto retSet = decomposeType(var.type);
-            usedTypes.insert(retSet.begin(), retSet.end());
+            const auto& var = std::get<Variable>(v);
+            collectTypes(var.type, false, completeTypes, declaredTypes);
         } else if (std::holds_alternative<Method>(v)) {
-            auto m      = std::get<Method>(v);
-            auto retSet = decomposeType(m.returnType);
-            usedTypes.insert(retSet.begin(), retSet.end());
+            // a method declaration doesn't need complete types, its definition in the source does
+            const auto& m = std::get<Method>(v);
+            collectTypes(m.returnType, true, completeTypes, declaredTypes);
             for (const auto& p : m.parameters) {
-                auto retSet = decomposeType(p.type);
-                usedTypes.insert(retSet.begin(), retSet.end());
+                collectTypes(p.type, true, completeTypes, declaredTypes);
             }
         }
     }
 
     // remove all types that don't need including
-    usedTypes.erase("void");
-    usedTypes.erase("bool");
-    usedTypes.erase("int");
-    usedTypes.erase("float");
-    usedTypes.erase("double");
-    usedTypes.erase("uint");
-    usedTypes.erase("unsigned int");
-
-    for (const auto& type : usedTypes) {
-        if (const auto& it = m_config->typeToIncludeMap().find(type); it != m_config->typeToIncludeMap().end()) {
-            c.externalIncludes.insert(it->second);
+    for (auto type : builtInTypes) {
+        completeTypes.erase(std::string(type));
+        declaredTypes.erase(std::string(type));
+    }
+
+    for (const auto& type : completeTypes) {
+        addInclude(c, type);
+    }
+
+    for (const auto& type : declaredTypes) {
+        if (completeTypes.contains(type)) {
+            continue;
+        }
+
+        // only model classes are declared, enums, aliases and library types can't be and are always included
+        const auto* declaration = m_declarations.find(c.namespaces, type);
+        if (!declaration || m_config->typeToIncludeMap().contains(type)) {
+            addInclude(c, type);
+        } else if (m_config->forwardDeclarations()) {
+            c.forwardDeclarations.insert(*declaration);
+            c.sourceIncludes.insert(includePath(type));
         } else {
-            size_t pos       = 0;
-            std::string path = type;
-            while ((pos = path.find("::", pos)) != std::string::npos) {
-                path.replace(pos, 2, "/");
-                pos += 1; // Handles case where 'to' is a substring of 'from'
-            }
-            c.localIncludes.insert(path + ".h");
+            // remembered, so the include graph can replace it if it closes a cycle
+            addInclude(c, type);
+            c.declarableIncludes.emplace(includePath(type), *declaration);
         }
     }
 }
 
-std::set<std::string> IncludeGatherer::decomposeType(const Common::Type& type)
+void IncludeGatherer::collectTypes(const Common::Type& type,
+                                   bool declarationSuffices,
+                                   std::set<std::string>& completeTypes,
+                                   std::set<std::string>& declaredTypes)
 {
-    std::set<std::string> out{type.base};
+    // values of non-type template parameters like the size of std::array
+    if (type.base.empty() || std::isdigit(static_cast<unsigned char>(type.base.front()))) {
+        return;
+    }
+
+    auto base = type.base;
+    declarationSuffices |= stripIndirection(base);
+
+    (declarationSuffices ? declaredTypes : completeTypes).insert(base);
+
+    declarationSuffices |= std::ranges::find(indirectionTemplates, base) != indirectionTemplates.end();
     for (const auto& param : type.templateParams) {
-        auto paramSet = decomposeType(param);
-        out.insert(paramSet.begin(), paramSet.end());
+        collectTypes(param, declarationSuffices, completeTypes, declaredTypes);
     }
+}
 
-    return out;
+void IncludeGatherer::addInclude(Class& c, const std::string& type)
+{
+    if (const auto& it = m_config->typeToIncludeMap().find(type); it != m_config->typeToIncludeMap().end()) {
+        c.externalIncludes.insert(it->second);
+    } else if (auto support = SupportHeaders::includeOfType(type, *m_config);
+               support && !m_declarations.find(c.namespaces, type)) {
+        c.localIncludes.insert(*support);
+    } else {
+        c.localIncludes.insert(includePath(type));
+    }
+}
+
+std::string IncludeGatherer::includePath(const std::string& type)
+{
+    size_t pos       = 0;
+    std::string path = type.starts_with("::") ? type.substr(2) : type;
+    while ((pos = path.find("::", pos)) != std::string::npos) {
+        path.replace(pos, 2, "/");
+        pos += 1; // Handles case where 'to' is a substring of 'from'
+    }
+    return path + ".h";
 }
 
 } // namespace Cpp::Class
@@ -0,0 +1,334 @@
+#include "Cpp/Class/IncludeGraph.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <ranges>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace Cpp::Class {
+
+namespace {
+
+void set(std::vector<std::uint64_t>& bits, size_t i)
+{
+    bits[i / 64] |= std::uint64_t(1) << (i % 64);
+}
+
+bool test(const std::vector<std::uint64_t>& bits, size_t i)
+{
+    return (bits[i / 64] >> (i % 64)) & 1;
+}
+
+std::string headerOf(const Class& c)
+{
+    std::string header;
+    for (const auto& ns : c.namespaces) {
+        header += ns + "/";
+    }
+    return header + c.name + ".h";
+}
+
+// moves an include to the source and declares the class instead, if a declaration suffices
+bool declare(Class& c, const std::string& include)
+{
+    auto declarable = c.declarableIncludes.find(include);
+    if (declarable == c.declarableIncludes.end() || !c.localIncludes.erase(include)) {
+        return false;
+    }
+
+    c.forwardDeclarations.insert(declarable->second);
+    c.sourceIncludes.insert(include);
+    c.declarableIncludes.erase(declarable);
+    return true;
+}
+
+} // namespace
+
+IncludeGraph::IncludeGraph(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
+void IncludeGraph::process(std::vector<Class>& classes)
+{
+    build(classes);
+    breakCycles(classes);
+
+    if (m_config->minimizeIncludes()) {
+        reduce(classes);
+    }
+}
+
+void IncludeGraph::index(std::vector<Class>& classes)
+{
+    process(classes);
+
+    m_projectChanges.clear();
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_projectChanges.add(classes[i].namespaces, classes[i].name, std::move(m_changes[i]));
+    }
+}
+
+void IncludeGraph::apply(std::vector<Class>& classes) const
+{
+    for (auto& c : classes) {
+        const auto* changes = m_projectChanges.at(c.namespaces, c.name);
+        if (!changes) {
+            continue;
+        }
+
+        for (const auto& include : changes->declared) {
+            declare(c, include);
+        }
+        for (const auto& include : changes->dropped) {
+            c.localIncludes.erase(include);
+        }
+    }
+}
+
+void IncludeGraph::build(const std::vector<Class>& classes)
+{
+    m_headers.clear();
+    m_edges.assign(classes.size(), {});
+    m_changes.assign(classes.size(), {});
+
+    std::unordered_map<std::string, size_t> classByHeader;
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_headers.push_back(headerOf(classes[i]));
+        classByHeader.emplace(m_headers.back(), i);
+    }
+
+    for (size_t i = 0; i < classes.size(); ++i) {
+        const auto& c = classes[i];
+        for (const auto& include : c.localIncludes) {
+            // like names, includes are resolved from the namespace of the class outwards
+            auto target = classByHeader.end();
+            for (size_t depth = c.namespaces.size() + 1; depth-- > 0 && target == classByHeader.end();) {
+                std::string prefix;
+                for (const auto& ns : c.namespaces | std::views::take(depth)) {
+                    prefix += ns + "/";
+                }
+                target = classByHeader.find(prefix + include);
+            }
+
+            // includes of non-class headers (enums, variants, ...) and of the own header aren't part of the graph
+            if (target != classByHeader.end() && target->second != i) {
+                m_edges[i].push_back({target->second, include});
+            }
+        }
+    }
+}
+
+void IncludeGraph::findComponents()
+{
+    // Tarjan's algorithm, iterative so long include chains can't overflow the stack
+    constexpr size_t unvisited = static_cast<size_t>(-1);
+
+    size_t count = m_edges.size();
+    std::vector<size_t> index(count, unvisited);
+    std::vector<size_t> lowLink(count, 0);
+    std::vector<bool> onStack(count, false);
+    std::vector<size_t> stack;
+    std::vector<std::pair<size_t, size_t>> callStack; // node and its next edge
+    size_t nextIndex = 0;
+
+    m_components.clear();
+    m_componentOf.assign(count, 0);
+
+    auto enter = [&](size_t node) {
+        index[node] = lowLink[node] = nextIndex++;
+        stack.push_back(node);
+        onStack[node] = true;
+        callStack.emplace_back(node, 0);
+    };
+
+    for (size_t root = 0; root < count; ++root) {
+        if (index[root] != unvisited) {
+            continue;
+        }
+
+        enter(root);
+        while (!callStack.empty()) {
+            auto [node, edge] = callStack.back();
+            if (edge < m_edges[node].size()) {
+                ++callStack.back().second;
+                auto target = m_edges[node][edge].target;
+                if (index[target] == unvisited) {
+                    enter(target);
+                } else if (onStack[target]) {
+                    lowLink[node] = std::min(lowLink[node], index[target]);
+                }
+                continue;
+            }
+
+            callStack.pop_back();
+            if (!callStack.empty()) {
+                auto parent     = callStack.back().first;
+                lowLink[parent] = std::min(lowLink[parent], lowLink[node]);
+            }
+
+            if (lowLink[node] == index[node]) {
+                auto& component = m_components.emplace_back();
+                size_t member   = 0;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    onStack[member]       = false;
+                    m_componentOf[member] = m_components.size() - 1;
+                    component.push_back(member);
+                } while (member != node);
+            }
+        }
+    }
+}
+
+void IncludeGraph::breakCycles(std::vector<Class>& classes)
+{
+    findComponents();
+
+    // within a cycle, every include that only needs a declaration is replaced by a forward declaration
+    bool changed = false;
+    for (const auto& component : m_components) {
+        if (component.size() < 2) {
+            continue;
+        }
+
+        for (auto node : component) {
+            changed |= std::erase_if(m_edges[node], [&](const Edge& edge) {
+                if (m_componentOf[edge.target] != m_componentOf[node] || !declare(classes[node], edge.include)) {
+                    return false;
+                }
+                m_changes[node].declared.insert(edge.include);
+                return true;
+            }) > 0;
+        }
+    }
+
+    if (!changed) {
+        return;
+    }
+
+    findComponents();
+    for (const auto& component : m_components) {
+        if (component.size() > 1) {
+            std::cout << "WARNING! Include cycle that can't be broken with forward declarations:";
+            for (auto node : component) {
+                std::cout << " " << m_headers[node];
+            }
+            std::cout << std::endl;
+        }
+    }
+}
+
+void IncludeGraph::reduce(std::vector<Class>& classes)
+{
+    auto reach = reachability();
+
+    // an include is redundant, if its header is also included by another included header
+    for (size_t node = 0; node < m_edges.size(); ++node) {
+        auto component = m_componentOf[node];
+        auto isRedundant = [&](const Edge& edge) {
+            auto targetComponent = m_componentOf[edge.target];
+            if (targetComponent == component) {
+                return false;
+            }
+            return std::ranges::any_of(m_edges[node], [&](const Edge& other) {
+                auto otherComponent = m_componentOf[other.target];
+                return otherComponent != component && otherComponent != targetComponent &&
+                       test(reach[otherComponent], edge.target);
+            });
+        };
+
+        std::vector<std::string> redundant;
+        for (const auto& edge : m_edges[node]) {
+            if (isRedundant(edge)) {
+                redundant.push_back(edge.include);
+            }
+        }
+
+        // removing all redundant includes at once keeps the reachability, as the components form a DAG
+        for (const auto& include : redundant) {
+            classes[node].localIncludes.erase(include);
+            m_changes[node].dropped.insert(include);
+            std::erase_if(m_edges[node], [&include](const Edge& edge) { return edge.include == include; });
+        }
+    }
+}
+
+void IncludeGraph::report(const std::vector<Class>& classes) const
+{
+    auto reach = reachability();
+
+    struct Row
+    {
+        size_t dependents = 0;
+        size_t fanIn      = 0;
+        size_t fanOut     = 0;
+    };
+    std::vector<Row> rows(classes.size());
+
+    size_t includes = 0;
+    for (size_t node = 0; node < m_edges.size(); ++node) {
+        rows[node].fanOut = m_edges[node].size();
+        includes += m_edges[node].size();
+        for (const auto& edge : m_edges[node]) {
+            ++rows[edge.target].fanIn;
+        }
+        for (size_t other = 0; other < m_edges.size(); ++other) {
+            if (other != node && test(reach[m_componentOf[node]], other)) {
+                ++rows[other].dependents;
+            }
+        }
+    }
+
+    // the headers that cause the most rebuilds when they change come first
+    std::vector<size_t> order(classes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, [&](size_t l, size_t r) {
+        return std::tie(rows[r].dependents, rows[r].fanIn, m_headers[l]) <
+               std::tie(rows[l].dependents, rows[l].fanIn, m_headers[r]);
+    });
+
+    std::cout << fmt::format("include report: {} headers, {} includes between them\n", classes.size(), includes);
+    std::cout << fmt::format("{:>10}  {:>6}  {:>7}  {}\n", "dependents", "fan-in", "fan-out", "header");
+    for (auto node : order) {
+        std::cout << fmt::format(
+            "{:>10}  {:>6}  {:>7}  {}\n", rows[node].dependents, rows[node].fanIn, rows[node].fanOut, m_headers[node]);
+    }
+    std::cout << std::flush;
+}
+
+std::vector<IncludeGraph::Bitset> IncludeGraph::reachability() const
+{
+    // the headers reachable from each component, components come in reverse topological order, so the components
+    // a component includes are complete when it is reached
+    size_t words = (m_edges.size() + 63) / 64;
+    std::vector<Bitset> reach(m_components.size(), Bitset(words, 0));
+
+    for (size_t component = 0; component < m_components.size(); ++component) {
+        auto& bits = reach[component];
+        for (auto node : m_components[component]) {
+            if (m_components[component].size() > 1) {
+                set(bits, node);
+            }
+            for (const auto& edge : m_edges[node]) {
+                auto target = m_componentOf[edge.target];
+                if (target == component) {
+                    continue;
+                }
+                set(bits, edge.target);
+                std::ranges::transform(bits, reach[target], bits.begin(), std::bit_or<>());
+            }
+        }
+    }
+
+    return reach;
+}
+
+} // namespace Cpp::Class
@@ -0,0 +1,148 @@
+#include "Cpp/Class/MemberLayoutOptimizer.h"
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace Cpp::Class {
+
+MemberLayoutOptimizer::MemberLayoutOptimizer(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+    , m_typeLayout(m_config)
+{
+}
+
+void MemberLayoutOptimizer::index(std::vector<Class>& classes)
+{
+    m_projectLayouts.clear();
+    optimize(classes);
+    if (!m_config->optimizeMemberLayout()) {
+        return;
+    }
+
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_projectLayouts.add(classes[i].namespaces, classes[i].name, m_layouts[i]);
+    }
+}
+
+void MemberLayoutOptimizer::optimize(std::vector<Class>& classes)
+{
+    if (!m_config->optimizeMemberLayout()) {
+        return;
+    }
+
+    m_classIndex.clear();
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_classIndex.add(classes[i].namespaces, classes[i].name, i);
+    }
+    m_states.assign(classes.size(), Common::VisitState::Pending);
+    m_layouts.assign(classes.size(), std::nullopt);
+
+    for (size_t i = 0; i < classes.size(); ++i) {
+        optimize(classes, i);
+    }
+}
+
+std::optional<Common::Layout> MemberLayoutOptimizer::optimize(std::vector<Class>& classes, size_t index)
+{
+    // a class that contains itself by value has no layout anyway
+    if (m_states[index] != Common::VisitState::Pending) {
+        return m_layouts[index];
+    }
+    m_states[index] = Common::VisitState::InProgress;
+
+    auto& c      = classes[index];
+    auto resolve = [this, &classes, &c](const std::string& type) -> std::optional<Common::Layout> {
+        if (const auto* other = m_classIndex.find(c.namespaces, type)) {
+            return optimize(classes, *other);
+        }
+        if (const auto* layout = m_projectLayouts.find(c.namespaces, type)) {
+            return *layout;
+        }
+        return std::nullopt;
+    };
+
+    // bases and the pointer to the vtable come before the data members
+    std::vector<Common::Layout> prefix;
+    bool known = true;
+    if (c.isInterface || std::ranges::any_of(c.body, [](const ClassElement& elem) {
+            return std::holds_alternative<Method>(elem) && std::get<Method>(elem).isAbstract;
+        })) {
+        prefix.push_back({8, 8});
+    }
+    for (const auto& base : c.inherits) {
+        auto layout = resolve(base);
+        known &= layout.has_value();
+        prefix.push_back(layout.value_or(Common::Layout{}));
+    }
+
+    // data members with their position in the body and the access section they are in
+    struct Member
+    {
+        size_t position;
+        size_t section;
+        Common::Layout layout;
+    };
+    std::vector<Member> members;
+    size_t section = 0;
+    for (size_t i = 0; i < c.body.size(); ++i) {
+        if (std::holds_alternative<VisibilityKeyword>(c.body[i])) {
+            ++section;
+        } else if (std::holds_alternative<Variable>(c.body[i]) && !std::get<Variable>(c.body[i]).isStatic) {
+            auto layout = m_typeLayout.layoutOf(std::get<Variable>(c.body[i]).type, resolve);
+            known &= layout.has_value();
+            members.push_back({i, section, layout.value_or(Common::Layout{})});
+        }
+    }
+
+    auto classLayout = [&prefix, &members]() {
+        auto layouts = prefix;
+        std::ranges::transform(members, std::back_inserter(layouts), &Member::layout);
+        return Common::TypeLayout::structLayout(layouts);
+    };
+
+    if (!known) {
+        m_states[index] = Common::VisitState::Done;
+        return std::nullopt;
+    }
+
+    auto before = classLayout();
+
+    // reorder within each access section, the members take the slots the section had before
+    for (auto first = members.begin(); first != members.end();) {
+        auto last =
+            std::find_if(first, members.end(), [first](const Member& m) { return m.section != first->section; });
+
+        std::vector<Member> sorted(first, last);
+        std::ranges::stable_sort(sorted, [](const Member& l, const Member& r) {
+            return std::tie(r.layout.alignment, r.layout.size) < std::tie(l.layout.alignment, l.layout.size);
+        });
+
+        std::vector<ClassElement> variables;
+        for (const auto& m : sorted) {
+            variables.push_back(std::move(c.body[m.position]));
+        }
+        for (size_t i = 0; i < sorted.size(); ++i, ++first) {
+            c.body[first->position] = std::move(variables[i]);
+            first->layout           = sorted[i].layout;
+        }
+    }
+
+    auto after = classLayout();
+    if (!members.empty()) {
+        c.body.insert(c.body.begin(),
+                      fmt::format("{}// estimated sizeof: {} bytes ({} bytes before reordering the members)",
+                                  m_config->indent(),
+                                  after.size,
+                                  before.size));
+    }
+
+    m_states[index]  = Common::VisitState::Done;
+    m_layouts[index] = after;
+    return after;
+}
+
+} // namespace Cpp::Class
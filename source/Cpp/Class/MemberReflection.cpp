@@ -0,0 +1,74 @@
+#include "Cpp/Class/MemberReflection.h"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+namespace Cpp::Class {
+
+namespace {
+
+// the access in effect after the last element of the body
+bool endsPublic(const Class& c)
+{
+    auto last = std::ranges::find_if(c.body.rbegin(), c.body.rend(), [](const ClassElement& elem) {
+        return std::holds_alternative<VisibilityKeyword>(elem);
+    });
+    return last == c.body.rend() ? c.isStruct : std::get<VisibilityKeyword>(*last).name == "public:";
+}
+
+} // namespace
+
+MemberReflection::MemberReflection(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
+void MemberReflection::add(Class& c) const
+{
+    if (!m_config->memberReflection() || c.isInterface) {
+        return;
+    }
+
+    std::string_view variablePrefix;
+    if (!c.isStruct || !m_config->noMemberPrefixForStructs()) {
+        variablePrefix = m_config->memberPrefix();
+    }
+
+    // there are no pointers to static or reference members
+    std::vector<std::string> entries;
+    for (const auto& elem : c.body) {
+        if (const auto* var = std::get_if<Variable>(&elem);
+            var != nullptr && !var->isStatic && !var->type.base.ends_with('&')) {
+            entries.push_back("std::pair{std::string_view{\"" + var->name + "\"}, &" + c.name +
+                              "::" + std::string(variablePrefix) + var->name + "}");
+        }
+    }
+
+    const auto& indent = m_config->indent();
+    std::string function = indent + "// names and pointers of the data members in declaration order\n" + indent +
+                           "static constexpr auto reflectMembers()\n" + indent + "{\n" + indent + indent;
+    if (entries.empty()) {
+        function += "return std::tuple{};\n";
+    } else {
+        function += "return std::tuple{";
+        for (size_t i = 0; i < entries.size(); ++i) {
+            function += "\n" + indent + indent + indent + entries[i] + (i + 1 < entries.size() ? "," : "};\n");
+        }
+    }
+    function += indent + "}";
+
+    if (!c.body.empty()) {
+        c.body.emplace_back("");
+    }
+    if (!endsPublic(c)) {
+        c.body.emplace_back(VisibilityKeyword{"public:"});
+    }
+    c.body.emplace_back(std::move(function));
+
+    c.externalIncludes.insert({"string_view", "tuple", "utility"});
+}
+
+} // namespace Cpp::Class
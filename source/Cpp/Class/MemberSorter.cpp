@@ -1,32 +1,152 @@
 #include "Cpp/Class/MemberSorter.h"
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 namespace Cpp {
 namespace Class {
 
+namespace {
+
+enum class Visibility
+{
+    Public,
+    Protected,
+    Private,
+    Unspecified
+};
+
+constexpr std::array<std::string_view, 3> keywords = {"public:", "protected:", "private:"};
+
+Visibility toVisibility(const VisibilityKeyword& keyword)
+{
+    for (size_t i = 0; i < keywords.size(); ++i) {
+        if (keyword.name == keywords[i]) {
+            return static_cast<Visibility>(i);
+        }
+    }
+    return Visibility::Unspecified;
+}
+
+} // namespace
+
+MemberSorter::MemberSorter(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
 void MemberSorter::sort(Class& c)
 {
-    enum class Visibility
-    {
-        Public,
-        Private,
-        Protected
-    } lastVis = Visibility::Private;
-
-    if (c.isStruct) {
-        return;
+    if (m_config->groupByVisibility()) {
+        groupByVisibility(c);
+    } else if (!c.isStruct) {
+        addVisibilityKeywords(c);
     }
+}
 
-    for (auto it = c.body.begin(); it != c.body.end(); ++it) {
-        if (std::holds_alternative<VisibilityKeyword>(*it)) {
-            break;
-        } else if (std::holds_alternative<Variable>(*it) && lastVis != Visibility::Private) {
-            it      = c.body.insert(it, VisibilityKeyword{"private:"});
+void MemberSorter::addVisibilityKeywords(Class& c)
+{
+    // methods without visibility are public, variables private, until the first explicit keyword
+    auto needsKeyword = [](const ClassElement& elem, Visibility& lastVis) {
+        if (std::holds_alternative<Variable>(elem) && lastVis != Visibility::Private) {
             lastVis = Visibility::Private;
-        } else if (std::holds_alternative<Method>(*it) && lastVis != Visibility::Public) {
-            it      = c.body.insert(it, VisibilityKeyword{"public:"});
+            return true;
+        }
+        if (std::holds_alternative<Method>(elem) && lastVis != Visibility::Public) {
             lastVis = Visibility::Public;
+            return true;
+        }
+        return false;
+    };
+
+    // count first, so the new body is allocated once
+    size_t keywordCount = 0;
+    auto lastVis        = Visibility::Private;
+    for (const auto& elem : c.body) {
+        if (std::holds_alternative<VisibilityKeyword>(elem)) {
+            break;
         }
+        keywordCount += needsKeyword(elem, lastVis) ? 1 : 0;
+    }
+    if (keywordCount == 0) {
+        return;
     }
+
+    std::vector<ClassElement> body;
+    body.reserve(c.body.size() + keywordCount);
+
+    bool explicitVisibility = false;
+    lastVis                 = Visibility::Private;
+    for (auto& elem : c.body) {
+        explicitVisibility |= std::holds_alternative<VisibilityKeyword>(elem);
+        if (!explicitVisibility && needsKeyword(elem, lastVis)) {
+            body.emplace_back(VisibilityKeyword{std::string(keywords[static_cast<size_t>(lastVis)])});
+        }
+        body.push_back(std::move(elem));
+    }
+
+    c.body = std::move(body);
+}
+
+void MemberSorter::groupByVisibility(Class& c)
+{
+    // public, protected and private sections in this order, each with its methods before its data
+    std::array<std::vector<ClassElement>, 3> methods;
+    std::array<std::vector<ClassElement>, 3> data;
+
+    // comments and separators stay with the element that follows them
+    std::vector<ClassElement> pending;
+    auto current = Visibility::Unspecified;
+    auto place   = [&pending](std::vector<ClassElement>& group, ClassElement&& elem) {
+        std::move(pending.begin(), pending.end(), std::back_inserter(group));
+        pending.clear();
+        group.push_back(std::move(elem));
+    };
+
+    for (auto& elem : c.body) {
+        if (std::holds_alternative<VisibilityKeyword>(elem)) {
+            current = toVisibility(std::get<VisibilityKeyword>(elem));
+            continue;
+        }
+
+        bool isMethod = std::holds_alternative<Method>(elem);
+        if (!isMethod && !std::holds_alternative<Variable>(elem)) {
+            pending.push_back(std::move(elem));
+            continue;
+        }
+
+        auto vis = current;
+        if (vis == Visibility::Unspecified) {
+            vis = c.isStruct || isMethod ? Visibility::Public : Visibility::Private;
+        }
+        place(isMethod ? methods[static_cast<size_t>(vis)] : data[static_cast<size_t>(vis)], std::move(elem));
+    }
+
+    size_t size = pending.size() + keywords.size();
+    for (size_t i = 0; i < keywords.size(); ++i) {
+        size += methods[i].size() + data[i].size();
+    }
+
+    std::vector<ClassElement> body;
+    body.reserve(size);
+    for (size_t i = 0; i < keywords.size(); ++i) {
+        if (methods[i].empty() && data[i].empty()) {
+            continue;
+        }
+        // a struct starts public anyway
+        if (!(c.isStruct && body.empty() && static_cast<Visibility>(i) == Visibility::Public)) {
+            body.emplace_back(VisibilityKeyword{std::string(keywords[i])});
+        }
+        std::move(methods[i].begin(), methods[i].end(), std::back_inserter(body));
+        std::move(data[i].begin(), data[i].end(), std::back_inserter(body));
+    }
+    std::move(pending.begin(), pending.end(), std::back_inserter(body));
+
+    c.body = std::move(body);
 }
 
 } // namespace Class
@@ -5,15 +5,69 @@ namespace Class {
 
 PostProcessor::PostProcessor(std::shared_ptr<Config> config)
     : m_config(config)
+    , m_structOfArrays(m_config)
+    , m_finalSpecifiers(m_config)
     , m_gatherer(m_config)
+    , m_includeGraph(m_config)
+    , m_sorter(m_config)
+    , m_layoutOptimizer(m_config)
+    , m_specialMembers(m_config)
+    , m_equalityAndHash(m_config)
+    , m_memberReflection(m_config)
 {}
 
-void PostProcessor::process(std::vector<Class>& classes)
+void PostProcessor::index(std::vector<Class> classes, const std::vector<Enum::Enum>& enums)
 {
+    // the same steps as in process, the analyses across models keep their results for the classes of each model
+    m_structOfArrays.addCompanions(classes);
+    m_finalSpecifiers.index(classes);
+
+    m_gatherer.index(classes);
+    for (auto& c : classes) {
+        m_gatherer.gather(c);
+        m_sorter.sort(c);
+    }
+
+    m_includeGraph.index(classes);
+    // the report covers the whole project once instead of every model
+    if (m_config->includeReport()) {
+        m_includeGraph.report(classes);
+    }
+    m_layoutOptimizer.index(classes);
+    m_specialMembers.index(classes);
+    m_equalityAndHash.index(classes, enums);
+
+    m_indexed = true;
+}
+
+void PostProcessor::process(std::vector<Class>& classes, const std::vector<Enum::Enum>& enums)
+{
+    // companions are classes of their own that need includes like all others
+    m_structOfArrays.addCompanions(classes);
+    m_finalSpecifiers.add(classes);
+
+    // without an index of the project, the model is all there is
+    if (!m_indexed) {
+        m_gatherer.index(classes);
+    }
     for (auto& c : classes) {
         m_gatherer.gather(c);
         m_sorter.sort(c);
     }
+
+    // the includes and members of all classes are known now
+    if (m_indexed) {
+        m_includeGraph.apply(classes);
+    } else {
+        m_includeGraph.process(classes);
+    }
+    m_layoutOptimizer.optimize(classes);
+    m_specialMembers.add(classes);
+    m_equalityAndHash.add(classes, enums);
+
+    for (auto& c : classes) {
+        m_memberReflection.add(c);
+    }
 }
 
 } // namespace Class
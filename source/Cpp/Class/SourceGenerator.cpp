@@ -5,9 +5,11 @@
 
 namespace Cpp::Class {
 
-SourceGenerator::SourceGenerator(std::shared_ptr<Config> config)
+SourceGenerator::SourceGenerator(std::shared_ptr<Config> config,
+                                 std::shared_ptr<Common::TypeRenderer> typeRenderer)
     : m_config(std::move(config))
     , m_genUtils(m_config)
+    , m_typeRenderer(std::move(typeRenderer))
 {
 }
 
@@ -29,23 +31,31 @@ std::string SourceGenerator::generate(const Class& in)
         return "";
     }
 
-    std::string ret;
+    Common::CodeEmitter out(256 + 64 * in.body.size());
 
     // include header
-    ret += "#include \"";
+    out << "#include \"";
     for (const auto& ns : in.namespaces) {
-        ret += ns + "/";
+        out << ns << "/";
+    }
+    out << in.name << ".h\"\n\n";
+
+    // complete types the header only declares
+    for (const auto& inc : in.sourceIncludes) {
+        out << "#include \"" << inc << "\"\n";
+    }
+    if (!in.sourceIncludes.empty()) {
+        out << "\n";
     }
-    ret += in.name + ".h\"\n\n";
 
     // open namespaces
-    ret += m_genUtils.openNamespaces(in.namespaces);
+    m_genUtils.openNamespaces(out, in.namespaces);
 
     // static members
     for (const auto& elem : in.body) {
         if (std::holds_alternative<Variable>(elem) && std::get<Variable>(elem).isStatic) {
             const auto& var = std::get<Variable>(elem);
-            ret += typeToString(var.type) + " " + in.name + "::" + var.name + ";\n";
+            out << m_typeRenderer->render(var.type) << " " << in.name << "::" << var.name << ";\n";
         }
     }
 
@@ -53,35 +63,18 @@ std::string SourceGenerator::generate(const Class& in)
     for (const auto& elem : in.body) {
         if (std::holds_alternative<Method>(elem)) {
             const auto& m = std::get<Method>(elem);
-            ret += typeToString(m.returnType) + " " + in.name + "::" + m.name + "(";
-            if (!m.parameters.empty()) {
-                for (const auto& param : m.parameters) {
-                    ret += typeToString(param.type) + " " + param.name + ", ";
-                }
-                ret.erase(ret.length() - 2);
-            }
-            ret += ") {}\n\n";
+            out << m_typeRenderer->render(m.returnType) << " " << in.name << "::" << m.name << "(";
+            out.join(m.parameters, ", ", [this](Common::CodeEmitter& o, const Parameter& param) {
+                o << m_typeRenderer->render(param.type) << " " << param.name;
+            });
+            out << ") {}\n\n";
         }
     }
 
     // close namespaces
-    ret += m_genUtils.closeNamespaces(in.namespaces);
-
-    return ret;
-}
-
-std::string SourceGenerator::typeToString(const Common::Type& t)
-{
-    std::string templ;
-    for (const auto& param : t.templateParams) {
-        templ += typeToString(param) + ", ";
-    }
-    if (!t.templateParams.empty()) {
-        templ.erase(templ.length() - 2);
-        templ = "<" + templ + ">";
-    }
+    m_genUtils.closeNamespaces(out, in.namespaces);
 
-    return t.base + templ;
+    return out.str();
 }
 
 } // namespace Cpp::Class
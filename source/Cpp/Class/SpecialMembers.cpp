@@ -0,0 +1,187 @@
+#include "Cpp/Class/SpecialMembers.h"
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+namespace Cpp::Class {
+
+namespace {
+
+// copying or moving these only copies or moves what refers to the arguments
+constexpr std::array<std::string_view, 5> referringTemplates = {
+    "std::unique_ptr", "std::shared_ptr", "std::weak_ptr", "IntrusivePtr", "Handle"};
+
+// these store their arguments inline, so moving them moves the arguments, other containers only move a pointer
+constexpr std::array<std::string_view, 7> inlineTemplates = {"std::optional",
+                                                             "std::pair",
+                                                             "std::tuple",
+                                                             "std::array",
+                                                             "std::variant",
+                                                             "boost::container::static_vector",
+                                                             "boost::container::small_vector"};
+
+bool isPolymorphic(const Class& c)
+{
+    return c.isInterface || std::ranges::any_of(c.body, [](const ClassElement& elem) {
+               return std::holds_alternative<Method>(elem) && std::get<Method>(elem).isAbstract;
+           });
+}
+
+} // namespace
+
+SpecialMembers::Traits& SpecialMembers::Traits::operator&=(const Traits& other)
+{
+    copyable &= other.copyable;
+    movable &= other.movable;
+    nothrowMove &= other.nothrowMove;
+    return *this;
+}
+
+SpecialMembers::SpecialMembers(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
+void SpecialMembers::index(const std::vector<Class>& classes)
+{
+    m_projectTraits.clear();
+    if (std::ranges::none_of(classes, [this](const Class& c) { return wanted(c); })) {
+        return;
+    }
+
+    indexClasses(classes);
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_projectTraits.add(classes[i].namespaces, classes[i].name, traits(classes, i));
+    }
+}
+
+void SpecialMembers::add(std::vector<Class>& classes)
+{
+    if (std::ranges::none_of(classes, [this](const Class& c) { return wanted(c); })) {
+        return;
+    }
+
+    indexClasses(classes);
+
+    for (size_t i = 0; i < classes.size(); ++i) {
+        auto& c = classes[i];
+        if (!wanted(c)) {
+            continue;
+        }
+
+        auto elements = declarations(c, traits(classes, i));
+
+        // after leading comments, in the public section
+        auto first = std::ranges::find_if(c.body, [](const ClassElement& elem) {
+            return !std::holds_alternative<std::string>(elem) && !std::holds_alternative<Separator>(elem);
+        });
+        bool startsPublic = first != c.body.end() && std::holds_alternative<VisibilityKeyword>(*first) &&
+                            std::get<VisibilityKeyword>(*first).name == "public:";
+        if (startsPublic) {
+            ++first;
+        } else if (!c.isStruct) {
+            elements.insert(elements.begin(), VisibilityKeyword{"public:"});
+            // members without a keyword were private before
+            if (first != c.body.end() && !std::holds_alternative<VisibilityKeyword>(*first)) {
+                elements.emplace_back(VisibilityKeyword{"private:"});
+            }
+        }
+        if (first != c.body.end() && !std::holds_alternative<VisibilityKeyword>(elements.back())) {
+            elements.emplace_back("");
+        }
+
+        c.body.insert(first, std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()));
+    }
+}
+
+void SpecialMembers::indexClasses(const std::vector<Class>& classes)
+{
+    m_classIndex.clear();
+    for (size_t i = 0; i < classes.size(); ++i) {
+        m_classIndex.add(classes[i].namespaces, classes[i].name, i);
+    }
+    m_states.assign(classes.size(), Common::VisitState::Pending);
+    m_traits.assign(classes.size(), Traits{});
+}
+
+SpecialMembers::Traits SpecialMembers::traits(const std::vector<Class>& classes, size_t index)
+{
+    // a class that contains itself doesn't restrict itself
+    if (m_states[index] != Common::VisitState::Pending) {
+        return m_traits[index];
+    }
+    m_states[index] = Common::VisitState::InProgress;
+
+    const auto& c = classes[index];
+    Traits result;
+    for (const auto& base : c.inherits) {
+        result &= traits(classes, c, Common::Type{base});
+    }
+    for (const auto& elem : c.body) {
+        if (const auto* var = std::get_if<Variable>(&elem); var != nullptr && !var->isStatic) {
+            result &= traits(classes, c, var->type);
+        }
+    }
+
+    m_states[index] = Common::VisitState::Done;
+    m_traits[index] = result;
+    return result;
+}
+
+SpecialMembers::Traits SpecialMembers::traits(const std::vector<Class>& classes,
+                                              const Class& scope,
+                                              const Common::Type& type)
+{
+    const auto& base = type.base;
+    if (base.empty() || base.ends_with('*') || base.ends_with('&')) {
+        return {};
+    }
+    if (m_config->nonMovableTypes().contains(base)) {
+        return {false, false, true};
+    }
+
+    Traits result;
+    result.copyable    = !m_config->nonCopyableTypes().contains(base);
+    result.nothrowMove = !m_config->throwingMoveTypes().contains(base);
+    if (const auto* other = m_classIndex.find(scope.namespaces, base)) {
+        result &= traits(classes, *other);
+    } else if (const auto* known = m_projectTraits.find(scope.namespaces, base)) {
+        result &= *known;
+    }
+
+    if (std::ranges::find(referringTemplates, base) != referringTemplates.end()) {
+        return result;
+    }
+    bool storesInline = std::ranges::find(inlineTemplates, base) != inlineTemplates.end();
+    for (const auto& param : type.templateParams) {
+        auto paramTraits = traits(classes, scope, param);
+        paramTraits.nothrowMove |= !storesInline;
+        result &= paramTraits;
+    }
+    return result;
+}
+
+bool SpecialMembers::wanted(const Class& c) const
+{
+    return m_config->specialMembers() || m_config->specialMembersStereotypes().contains(c.stereotype);
+}
+
+std::vector<ClassElement> SpecialMembers::declarations(const Class& c, const Traits& traits) const
+{
+    std::string copy = traits.copyable && traits.movable ? " = default;" : " = delete;";
+    std::string move = !traits.movable ? " = delete;" : traits.nothrowMove ? " noexcept = default;" : " = default;";
+
+    const auto& indent = m_config->indent();
+    const auto& name   = c.name;
+    return {indent + name + "() = default;",
+            indent + (isPolymorphic(c) ? "virtual ~" : "~") + name + "() = default;",
+            indent + name + "(const " + name + "&)" + copy,
+            indent + name + "& operator=(const " + name + "&)" + copy,
+            indent + name + "(" + name + "&&)" + move,
+            indent + name + "& operator=(" + name + "&&)" + move};
+}
+
+} // namespace Cpp::Class
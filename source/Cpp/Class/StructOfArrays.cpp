@@ -0,0 +1,136 @@
+#include "Cpp/Class/StructOfArrays.h"
+
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include <fmt/core.h>
+
+namespace Cpp::Class {
+
+namespace {
+
+constexpr std::string_view stereotype = "SoA";
+
+// the data members that become columns, none if the class doesn't get a companion
+std::vector<const Variable*> columns(const Class& c)
+{
+    if (c.stereotype != stereotype) {
+        return {};
+    }
+
+    // the companion copies the members in and out of an element, so they have to be accessible
+    std::vector<const Variable*> members;
+    bool isPublic = c.isStruct;
+    for (const auto& elem : c.body) {
+        if (const auto* keyword = std::get_if<VisibilityKeyword>(&elem)) {
+            isPublic = keyword->name == "public:";
+        } else if (const auto* var = std::get_if<Variable>(&elem); var != nullptr && !var->isStatic) {
+            if (!isPublic) {
+                return {};
+            }
+            members.push_back(var);
+        }
+    }
+    return members;
+}
+
+} // namespace
+
+StructOfArrays::StructOfArrays(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
+void StructOfArrays::addCompanions(std::vector<Class>& classes)
+{
+    // companions are appended, only look at the classes of the model
+    auto count = classes.size();
+    for (size_t i = 0; i < count; ++i) {
+        // without a column there is nothing that knows the size
+        auto members = columns(classes[i]);
+        if (!members.empty()) {
+            auto soa = companion(classes[i], members);
+            classes.push_back(std::move(soa));
+        }
+    }
+}
+
+bool StructOfArrays::hasCompanion(const Class& c)
+{
+    return !columns(c).empty();
+}
+
+Class StructOfArrays::companion(const Class& c, const std::vector<const Variable*>& members) const
+{
+    // the companion is a struct, the element follows its own prefix rule
+    std::string prefix = m_config->noMemberPrefixForStructs() ? "" : m_config->memberPrefix();
+    std::string elementPrefix = c.isStruct && m_config->noMemberPrefixForStructs() ? "" : m_config->memberPrefix();
+    std::string indent = m_config->indent();
+    std::string nested = indent + indent;
+
+    Class soa;
+    soa.name       = c.name + std::string(stereotype);
+    soa.isStruct   = true;
+    soa.namespaces = c.namespaces;
+    soa.externalIncludes.insert("cstddef");
+    // elements are copied in and out, so the complete type is needed
+    soa.localIncludes.insert(c.name + ".h");
+
+    for (const auto* var : members) {
+        soa.body.emplace_back(Variable{var->name, Common::Type{"std::vector", {var->type}}, var->comment});
+    }
+
+    // one line or list entry per column, {0} is the name of the column and {1} the name of the member
+    auto lines = [&members, &prefix](const std::string& pattern) {
+        std::string out;
+        for (const auto* var : members) {
+            out += fmt::format(fmt::runtime(pattern), prefix + var->name, var->name);
+        }
+        return out;
+    };
+    auto list = [&members, &prefix](std::string_view pattern) {
+        std::string out;
+        for (const auto* var : members) {
+            out += (out.empty() ? "" : ", ") + fmt::format(fmt::runtime(pattern), prefix + var->name);
+        }
+        return out;
+    };
+    auto proxy = [&](std::string_view name, std::string_view reference) {
+        return indent + "struct " + std::string(name) + "\n" + indent + "{\n" +
+               lines(nested + "decltype(" + soa.name + "::{0})::" + std::string(reference) + " {0};\n") + indent +
+               "};";
+    };
+    auto function = [&](const std::string& signature, const std::string& pattern) {
+        return indent + signature + "\n" + indent + "{\n" + lines(nested + pattern + "\n") + indent + "}";
+    };
+    auto first = prefix + members.front()->name;
+
+    soa.body.emplace_back("");
+    soa.body.emplace_back(indent + "// refers to the members of one element");
+    soa.body.emplace_back(proxy("Reference", "reference"));
+    soa.body.emplace_back("");
+    soa.body.emplace_back(proxy("ConstReference", "const_reference"));
+    soa.body.emplace_back("");
+    soa.body.emplace_back(indent + "size_t size() const { return " + first + ".size(); }");
+    soa.body.emplace_back(indent + "bool empty() const { return " + first + ".empty(); }");
+    soa.body.emplace_back("");
+    soa.body.emplace_back(function("void reserve(size_t capacity)", "{0}.reserve(capacity);"));
+    soa.body.emplace_back("");
+    soa.body.emplace_back(function("void clear()", "{0}.clear();"));
+    soa.body.emplace_back("");
+    soa.body.emplace_back(
+        function("void push_back(const " + c.name + "& element)", "{0}.push_back(element." + elementPrefix + "{1});"));
+    soa.body.emplace_back("");
+    soa.body.emplace_back(indent + c.name + " get(size_t index) const\n" + indent + "{\n" + nested + c.name +
+                          " element;\n" + lines(nested + "element." + elementPrefix + "{1} = {0}[index];\n") + nested +
+                          "return element;\n" + indent + "}");
+    soa.body.emplace_back("");
+    soa.body.emplace_back(indent + "Reference operator[](size_t index) { return {" + list("{0}[index]") + "}; }");
+    soa.body.emplace_back(indent + "ConstReference operator[](size_t index) const { return {" + list("{0}[index]") +
+                          "}; }");
+
+    return soa;
+}
+
+} // namespace Cpp::Class
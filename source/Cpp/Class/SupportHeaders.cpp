@@ -0,0 +1,622 @@
+#include "Cpp/Class/SupportHeaders.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace Cpp::Class {
+
+namespace {
+
+constexpr std::string_view refCounted = R"(#pragma once
+
+#include <cstdint>
+
+// base of classes that are aggregated through IntrusivePtr, the count is not atomic
+class RefCounted
+{
+public:
+    void addReference() const noexcept { ++m_references; }
+    // true if the last reference was released
+    bool releaseReference() const noexcept { return --m_references == 0; }
+
+protected:
+    RefCounted() = default;
+    RefCounted(const RefCounted& /*other*/) noexcept {}
+    RefCounted& operator=(const RefCounted& /*other*/) noexcept { return *this; }
+    ~RefCounted() = default;
+
+private:
+    mutable std::uint32_t m_references = 0;
+};
+)";
+
+constexpr std::string_view intrusivePtr = R"(#pragma once
+
+#include <cstddef>
+#include <utility>
+
+// shared ownership of an object that counts its references itself (see RefCounted), without a separate control block
+template <typename T>
+class IntrusivePtr
+{
+public:
+    IntrusivePtr() noexcept = default;
+    IntrusivePtr(std::nullptr_t) noexcept {}
+    explicit IntrusivePtr(T* object) noexcept
+        : m_object(object)
+    {
+        if (m_object) {
+            m_object->addReference();
+        }
+    }
+    IntrusivePtr(const IntrusivePtr& other) noexcept
+        : IntrusivePtr(other.m_object)
+    {
+    }
+    IntrusivePtr(IntrusivePtr&& other) noexcept
+        : m_object(std::exchange(other.m_object, nullptr))
+    {
+    }
+    ~IntrusivePtr() { reset(); }
+
+    IntrusivePtr& operator=(IntrusivePtr other) noexcept
+    {
+        std::swap(m_object, other.m_object);
+        return *this;
+    }
+
+    void reset() noexcept
+    {
+        if (m_object && m_object->releaseReference()) {
+            delete m_object;
+        }
+        m_object = nullptr;
+    }
+
+    T* get() const noexcept { return m_object; }
+    T& operator*() const noexcept { return *m_object; }
+    T* operator->() const noexcept { return m_object; }
+    explicit operator bool() const noexcept { return m_object != nullptr; }
+    bool operator==(const IntrusivePtr& other) const noexcept { return m_object == other.m_object; }
+
+private:
+    T* m_object = nullptr;
+};
+
+template <typename T, typename... Args>
+IntrusivePtr<T> makeIntrusive(Args&&... args)
+{
+    return IntrusivePtr<T>(new T(std::forward<Args>(args)...));
+}
+)";
+
+constexpr std::string_view handle = R"(#pragma once
+
+#include <cstdint>
+
+// refers to an object in an ObjectPool<T>, the generation detects handles to released objects
+template <typename T>
+struct Handle
+{
+    static constexpr std::uint32_t invalid = ~std::uint32_t(0);
+
+    std::uint32_t index      = invalid;
+    std::uint32_t generation = 0;
+
+    explicit operator bool() const noexcept { return index != invalid; }
+    bool operator==(const Handle&) const noexcept = default;
+};
+)";
+
+constexpr std::string_view objectPool = R"(#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Handle.h"
+
+// stores the objects of one type contiguously, the slots of released objects are reused
+template <typename T>
+class ObjectPool
+{
+public:
+    template <typename... Args>
+    Handle<T> create(Args&&... args)
+    {
+        std::uint32_t index = 0;
+        if (m_free.empty()) {
+            index = static_cast<std::uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        } else {
+            index = m_free.back();
+            m_free.pop_back();
+        }
+
+        auto& slot = m_slots[index];
+        slot.object.emplace(std::forward<Args>(args)...);
+        return {index, slot.generation};
+    }
+
+    void release(Handle<T> handle)
+    {
+        if (auto* slot = find(handle)) {
+            slot->object.reset();
+            ++slot->generation;
+            m_free.push_back(handle.index);
+        }
+    }
+
+    // nullptr if the object was released
+    T* get(Handle<T> handle)
+    {
+        auto* slot = find(handle);
+        return slot ? &*slot->object : nullptr;
+    }
+    const T* get(Handle<T> handle) const { return const_cast<ObjectPool*>(this)->get(handle); }
+
+    size_t size() const { return m_slots.size() - m_free.size(); }
+
+private:
+    struct Slot
+    {
+        std::optional<T> object;
+        std::uint32_t generation = 0;
+    };
+
+    Slot* find(Handle<T> handle)
+    {
+        if (handle.index >= m_slots.size()) {
+            return nullptr;
+        }
+        auto& slot = m_slots[handle.index];
+        return slot.object && slot.generation == handle.generation ? &slot : nullptr;
+    }
+
+    std::vector<Slot> m_slots;
+    std::vector<std::uint32_t> m_free;
+};
+)";
+
+constexpr std::string_view wire = R"(#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Flat little-endian binary format: scalars in their width, strings and vectors of scalars prefixed with their size as
+// 32 bit unsigned integer and nested structs inline. Reading returns views that refer to the buffer instead of copies.
+namespace Wire {
+
+template <typename T>
+concept Scalar = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+namespace Detail {
+
+template <Scalar T>
+void store(std::byte* out, T value) noexcept
+{
+    std::memcpy(out, &value, sizeof(T));
+    if constexpr (std::endian::native == std::endian::big) {
+        std::reverse(out, out + sizeof(T));
+    }
+}
+
+template <Scalar T>
+T load(const std::byte* in) noexcept
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        return *in != std::byte{0};
+    } else {
+        std::byte bytes[sizeof(T)];
+        if constexpr (std::endian::native == std::endian::big) {
+            std::reverse_copy(in, in + sizeof(T), bytes);
+        } else {
+            std::copy(in, in + sizeof(T), bytes);
+        }
+        return std::bit_cast<T>(bytes);
+    }
+}
+
+} // namespace Detail
+
+template <typename T>
+struct Tag
+{
+};
+
+// the elements of a vector of scalars on the wire, decoded when they are accessed
+template <Scalar T>
+class ArrayView
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = T;
+
+        Iterator() noexcept = default;
+        explicit Iterator(const std::byte* pos) noexcept
+            : m_pos(pos)
+        {
+        }
+
+        T operator*() const noexcept { return Detail::load<T>(m_pos); }
+        Iterator& operator++() noexcept
+        {
+            m_pos += sizeof(T);
+            return *this;
+        }
+        Iterator operator++(int) noexcept
+        {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+        bool operator==(const Iterator&) const noexcept = default;
+
+    private:
+        const std::byte* m_pos = nullptr;
+    };
+
+    ArrayView() noexcept = default;
+    ArrayView(const std::byte* data, size_t size) noexcept
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    T operator[](size_t index) const noexcept { return Detail::load<T>(m_data + index * sizeof(T)); }
+    Iterator begin() const noexcept { return Iterator(m_data); }
+    Iterator end() const noexcept { return Iterator(m_data + m_size * sizeof(T)); }
+
+    std::vector<T> toVector() const { return std::vector<T>(begin(), end()); }
+
+private:
+    const std::byte* m_data = nullptr;
+    size_t m_size           = 0;
+};
+
+// writes into a buffer, or only counts the bytes if it has none
+class Writer
+{
+public:
+    Writer() noexcept = default;
+    explicit Writer(std::span<std::byte> out) noexcept
+        : m_out(out)
+    {
+    }
+
+    template <Scalar T>
+    void scalar(T value) noexcept
+    {
+        if (auto* out = reserve(sizeof(T))) {
+            Detail::store(out, value);
+        }
+    }
+
+    template <Scalar T>
+    void array(std::span<const T> values) noexcept
+    {
+        scalar(static_cast<std::uint32_t>(values.size()));
+        auto* out = reserve(values.size_bytes());
+        if (out == nullptr) {
+            return;
+        }
+        if constexpr (std::endian::native == std::endian::little && !std::is_same_v<T, bool>) {
+            std::memcpy(out, values.data(), values.size_bytes());
+        } else {
+            for (const auto& value : values) {
+                Detail::store(out, value);
+                out += sizeof(T);
+            }
+        }
+    }
+
+    void string(std::string_view value) noexcept
+    {
+        scalar(static_cast<std::uint32_t>(value.size()));
+        if (auto* out = reserve(value.size())) {
+            std::memcpy(out, value.data(), value.size());
+        }
+    }
+
+    // the bytes written so far, or needed if they exceed the buffer
+    size_t size() const noexcept { return m_size; }
+    bool ok() const noexcept { return m_size <= m_out.size(); }
+
+private:
+    std::byte* reserve(size_t size) noexcept
+    {
+        auto pos = m_size;
+        m_size += size;
+        return m_size <= m_out.size() && size > 0 ? m_out.data() + pos : nullptr;
+    }
+
+    std::span<std::byte> m_out;
+    size_t m_size = 0;
+};
+
+// reads from a buffer, reading past its end yields empty values and fails the reader
+class Reader
+{
+public:
+    explicit Reader(std::span<const std::byte> in) noexcept
+        : m_in(in)
+    {
+    }
+
+    template <Scalar T>
+    T scalar() noexcept
+    {
+        auto* in = consume(1, sizeof(T));
+        return in != nullptr ? Detail::load<T>(in) : T{};
+    }
+
+    template <Scalar T>
+    ArrayView<T> array() noexcept
+    {
+        auto size = scalar<std::uint32_t>();
+        auto* in  = consume(size, sizeof(T));
+        return in != nullptr ? ArrayView<T>(in, size) : ArrayView<T>();
+    }
+
+    std::string_view string() noexcept
+    {
+        auto size = scalar<std::uint32_t>();
+        auto* in  = consume(size, 1);
+        return in != nullptr ? std::string_view(reinterpret_cast<const char*>(in), size) : std::string_view();
+    }
+
+    // the bytes read so far
+    size_t size() const noexcept { return m_pos; }
+    bool ok() const noexcept { return !m_failed; }
+
+private:
+    const std::byte* consume(size_t count, size_t size) noexcept
+    {
+        if (m_failed || count > (m_in.size() - m_pos) / size) {
+            m_failed = true;
+            return nullptr;
+        }
+        auto* in = m_in.data() + m_pos;
+        m_pos += count * size;
+        return in;
+    }
+
+    std::span<const std::byte> m_in;
+    size_t m_pos  = 0;
+    bool m_failed = false;
+};
+
+// the encodings of the standard types, generated structs add theirs to their own namespace
+template <Scalar T>
+void wireWrite(Writer& out, T value) noexcept
+{
+    out.scalar(value);
+}
+
+template <Scalar T>
+T wireRead(Reader& in, Tag<T>) noexcept
+{
+    return in.template scalar<T>();
+}
+
+inline void wireWrite(Writer& out, std::string_view value) noexcept
+{
+    out.string(value);
+}
+
+inline std::string_view wireRead(Reader& in, Tag<std::string>) noexcept
+{
+    return in.string();
+}
+
+inline std::string_view wireRead(Reader& in, Tag<std::string_view>) noexcept
+{
+    return in.string();
+}
+
+template <Scalar T>
+void wireWrite(Writer& out, const std::vector<T>& values) noexcept
+{
+    out.array(std::span<const T>(values));
+}
+
+template <Scalar T>
+ArrayView<T> wireRead(Reader& in, Tag<std::vector<T>>) noexcept
+{
+    return in.template array<T>();
+}
+
+template <typename T>
+void put(Writer& out, const T& value) noexcept
+{
+    wireWrite(out, value);
+}
+
+template <typename T>
+auto get(Reader& in) noexcept
+{
+    return wireRead(in, Tag<std::remove_cv_t<T>>{});
+}
+
+// what reading a T returns
+template <typename T>
+using View = decltype(get<T>(std::declval<Reader&>()));
+
+template <typename T>
+size_t wireSize(const T& value) noexcept
+{
+    Writer counter;
+    put(counter, value);
+    return counter.size();
+}
+
+// returns the number of bytes written to the front of out, 0 if it is too small
+template <typename T>
+size_t write(const T& value, std::span<std::byte> out) noexcept
+{
+    Writer writer(out);
+    put(writer, value);
+    return writer.ok() ? writer.size() : 0;
+}
+
+// the view refers to in, nullopt if in ends before the value
+template <typename T>
+std::optional<View<T>> read(std::span<const std::byte> in) noexcept
+{
+    Reader reader(in);
+    auto value = get<T>(reader);
+    return reader.ok() ? std::optional<View<T>>(value) : std::nullopt;
+}
+
+} // namespace Wire
+)";
+
+constexpr std::string_view hash = R"(#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+
+// combines the hashes of the members of generated structs, containers and pairs have no std::hash and are combined
+// from their elements
+namespace Hash {
+
+template <typename T>
+concept StdHashable = std::is_default_constructible_v<std::hash<T>>;
+
+template <typename T>
+concept TupleLike = requires { std::tuple_size<T>::value; };
+
+template <typename T>
+void combine(std::size_t& seed, const T& value) noexcept
+{
+    if constexpr (StdHashable<T>) {
+        seed ^= std::hash<T>{}(value) + static_cast<std::size_t>(0x9e3779b97f4a7c15ull) + (seed << 6) + (seed >> 2);
+    } else if constexpr (std::ranges::range<const T>) {
+        std::size_t size = 0;
+        for (const auto& element : value) {
+            combine(seed, element);
+            ++size;
+        }
+        combine(seed, size);
+    } else {
+        static_assert(TupleLike<T>, "a member has neither a std::hash nor elements to hash");
+        std::apply([&seed](const auto&... elements) { (combine(seed, elements), ...); }, value);
+    }
+}
+
+} // namespace Hash
+)";
+
+// the headers of the types above, and the headers they need in addition
+struct SupportHeader
+{
+    std::string_view name;
+    std::string_view content;
+    std::string_view neededBy;
+};
+
+constexpr std::array<SupportHeader, 6> supportHeaders = {{{"RefCounted", refCounted, "RefCounted"},
+                                                          {"IntrusivePtr", intrusivePtr, "IntrusivePtr"},
+                                                          {"Handle", handle, "Handle"},
+                                                          {"ObjectPool", objectPool, "Handle"},
+                                                          {"Wire", wire, "Wire"},
+                                                          {"Hash", hash, "Hash"}}};
+
+// the types of the support headers the generated classes use
+constexpr std::array<std::string_view, 3> supportTypes = {"RefCounted", "IntrusivePtr", "Handle"};
+
+constexpr std::string_view folder = "PlantUML2Cpp";
+
+// the headers above are indented by four spaces per level
+std::string reindent(std::string_view content, const std::string& indent)
+{
+    std::string out;
+    out.reserve(content.size());
+    while (!content.empty()) {
+        auto end  = content.find('\n');
+        auto line = content.substr(0, end == std::string_view::npos ? end : end + 1);
+        content.remove_prefix(line.size());
+
+        auto spaces = line.find_first_not_of(' ');
+        for (size_t level = 0; spaces != std::string_view::npos && level < spaces / 4; ++level) {
+            out += indent;
+        }
+        out += line.substr(spaces == std::string_view::npos ? 0 : spaces / 4 * 4);
+    }
+    return out;
+}
+
+} // namespace
+
+SupportHeaders::SupportHeaders(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
+std::vector<File> SupportHeaders::generate(const std::vector<Class>& classes) const
+{
+    auto isIncluded = [this, &classes](std::string_view name) {
+        auto header = include(name, *m_config);
+        return std::ranges::any_of(classes, [&header](const Class& c) {
+            return c.localIncludes.contains(header) || c.sourceIncludes.contains(header);
+        });
+    };
+
+    // only the wire headers of the structs include it, they aren't classes of their own
+    bool hasWireFormat = std::ranges::any_of(classes, &Class::hasWireFormat);
+
+    std::vector<File> files;
+    for (const auto& support : supportHeaders) {
+        if (support.name == "Wire" ? hasWireFormat : isIncluded(support.neededBy)) {
+            auto content = reindent(support.content, m_config->indent());
+            // the support headers include each other from their folder, with the configured extension
+            for (auto pos = content.find(".h\"\n"); pos != std::string::npos; pos = content.find(".h\"\n", pos + 1)) {
+                content.replace(pos + 1, 1, m_config->headerFileExtention());
+            }
+            files.push_back({m_config->headersPath() / include(support.name, *m_config), std::move(content)});
+        }
+    }
+    return files;
+}
+
+std::string SupportHeaders::include(std::string_view name, const Config& config)
+{
+    return std::string(folder) + "/" + std::string(name) + "." + config.headerFileExtention();
+}
+
+std::optional<std::string> SupportHeaders::includeOfType(const std::string& type, const Config& config)
+{
+    if (std::ranges::find(supportTypes, type) == supportTypes.end()) {
+        return std::nullopt;
+    }
+    return include(type, config);
+}
+
+} // namespace Cpp::Class
@@ -1,4 +1,5 @@
 #include "Cpp/Class/Translator.h"
+#include "Cpp/Class/StructOfArrays.h"
 #include "Cpp/Common/TranslatorUtils.h"
 #include "PlantUml/ModelElement.h"
 
@@ -10,8 +11,6 @@
 #include <string_view>
 #include <utility>
 
-#include <fmt/core.h>
-
 #include "Common/LogHelpers.h"
 
 namespace Cpp::Class {
@@ -22,11 +21,69 @@ Translator::Translator(std::shared_ptr<Config> config)
 {
 }
 
-std::vector<Class> Translator::results() &&
+void Translator::indexCompanions(Common::ModelIndex<bool>& companions) const
 {
+    for (const auto& c : m_classes) {
+        if (StructOfArrays::hasCompanion(c)) {
+            companions.add(c.namespaces, c.name, true);
+        }
+    }
+}
+
+std::vector<Class> Translator::results(const Common::ModelIndex<bool>& companions) &&
+{
+    // the elements of struct-of-arrays types are stored in the companion container of the type
+    for (const auto& composition : m_multiValuedCompositions) {
+        auto object = Common::findClass<Class>(composition.object, m_classes, composition.namespaceStack);
+        bool hasCompanion =
+            object != m_classes.end()
+                ? StructOfArrays::hasCompanion(*object)
+                : companions.find(composition.namespaceStack, Common::toNamespacedString(composition.object)) != nullptr;
+        if (hasCompanion) {
+            auto& var = std::get<Variable>(m_classes[composition.classIndex].body[composition.elementIndex]);
+            var.type  = Common::Type{Common::toNamespacedString(composition.object) + "SoA"};
+        }
+    }
+
+    for (const auto& aggregation : m_aggregations) {
+        resolveAggregation(aggregation);
+    }
+
     return m_classes;
 }
 
+Translator::PendingRelationship Translator::pending(const PlantUml::Relationship& r) const
+{
+    return {static_cast<size_t>(m_lastEncounteredClass - m_classes.begin()),
+            m_lastEncounteredClass->body.size(),
+            r.object,
+            m_namespaceStack,
+            r.objectCardinality};
+}
+
+void Translator::resolveAggregation(const PendingRelationship& aggregation)
+{
+    auto object = Common::findClass<Class>(aggregation.object, m_classes, aggregation.namespaceStack);
+
+    const auto* policy = &m_config->aggregationPolicy();
+    if (object != m_classes.end()) {
+        if (auto it = m_config->aggregationPolicyByStereotype().find(object->stereotype);
+            it != m_config->aggregationPolicyByStereotype().end()) {
+            policy = &it->second;
+        }
+    }
+
+    auto type = Common::toNamespacedString(aggregation.object);
+    auto& var = std::get<Variable>(m_classes[aggregation.classIndex].body[aggregation.elementIndex]);
+    var.type  = m_utils.aggregationType(aggregation.cardinality, type, *policy);
+
+    // the reference count of an intrusive pointer lives in the object
+    if (*policy == "intrusive" && object != m_classes.end() &&
+        std::ranges::find(object->inherits, "RefCounted") == object->inherits.end()) {
+        object->inherits.emplace_back("RefCounted");
+    }
+}
+
 bool Translator::visit(const PlantUml::Variable& v)
 {
     FuncTracer f_;
@@ -103,37 +160,28 @@ bool Translator::visit(const PlantUml::Relationship& r)
 
         case PlantUml::RelationshipType::Composition: {
             Variable var;
-            if (auto containerIt = m_config->containerByCardinalityComposition().find(r.objectCardinality);
-                containerIt != m_config->containerByCardinalityComposition().end()) {
-                var.type = m_utils.stringToCppType(
-                    fmt::format(fmt::runtime(containerIt->second), Common::toNamespacedString(r.object)));
-            } else {
-                var.type = Common::Type{Common::toNamespacedString(r.object)};
-            }
+            var.type = m_utils.compositionType(r.objectCardinality, Common::toNamespacedString(r.object));
 
             var.name = r.label;
             if (var.name.empty()) {
                 var.name    = r.object.back();
                 var.name[0] = std::tolower(var.name[0]);
             }
+            if (r.objectCardinality.find('*') != std::string::npos) {
+                m_multiValuedCompositions.push_back(pending(r));
+            }
             m_lastEncounteredClass->body.emplace_back(var);
             break;
         }
         case PlantUml::RelationshipType::Aggregation: {
+            // the type depends on the aggregation policy for the object
             Variable var;
-            if (auto containerIt = m_config->containerByCardinalityAggregation().find(r.objectCardinality);
-                containerIt != m_config->containerByCardinalityAggregation().end()) {
-                var.type = m_utils.stringToCppType(
-                    fmt::format(fmt::runtime(containerIt->second), Common::toNamespacedString(r.object)));
-            } else {
-                var.type = Common::Type{Common::toNamespacedString(r.object)};
-            }
-
             var.name = r.label;
             if (var.name.empty()) {
                 var.name    = r.object.back();
                 var.name[0] = std::tolower(var.name[0]);
             }
+            m_aggregations.push_back(pending(r));
             m_lastEncounteredClass->body.emplace_back(var);
             break;
         }
@@ -174,14 +222,15 @@ bool Translator::visit(const PlantUml::Element& e)
 
     if (process) {
         Class c;
+        bool structStereotype = e.stereotype == "Struct" || e.stereotype == "SoA" || e.stereotype.empty();
         if (e.type == PlantUml::ElementType::Interface) {
             c.isInterface = true;
-        } else if ((e.spotLetter == 'S' && (e.stereotype == "Struct" || e.stereotype.empty())) ||
-                   e.type == PlantUml::ElementType::Entity) {
+        } else if ((e.spotLetter == 'S' && structStereotype) || e.type == PlantUml::ElementType::Entity) {
             c.isStruct = true;
         }
 
         c.name       = e.name.back();
+        c.stereotype = e.stereotype;
         c.namespaces = m_namespaceStack;
         c.namespaces.insert(c.namespaces.end(), e.name.begin(), e.name.end());
         c.namespaces.pop_back();
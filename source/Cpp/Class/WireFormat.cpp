@@ -0,0 +1,202 @@
+#include "Cpp/Class/WireFormat.h"
+
+#include <numeric>
+#include <optional>
+#include <set>
+#include <utility>
+#include <variant>
+
+#include "Cpp/Class/SupportHeaders.h"
+
+#include <filesystem>
+namespace fs = std::filesystem;
+
+namespace Cpp::Class {
+
+namespace {
+
+// the non-static data members, nullopt if one of them isn't public
+std::optional<std::vector<const Variable*>> publicMembers(const Class& c)
+{
+    std::vector<const Variable*> members;
+    bool isPublic = c.isStruct;
+    for (const auto& elem : c.body) {
+        if (const auto* keyword = std::get_if<VisibilityKeyword>(&elem)) {
+            isPublic = keyword->name == "public:";
+        } else if (const auto* var = std::get_if<Variable>(&elem); var != nullptr && !var->isStatic) {
+            if (!isPublic) {
+                return std::nullopt;
+            }
+            members.push_back(var);
+        }
+    }
+    return members;
+}
+
+} // namespace
+
+WireFormat::WireFormat(std::shared_ptr<Config> config, std::shared_ptr<Common::TypeRenderer> typeRenderer)
+    : m_config(std::move(config))
+    , m_typeRenderer(std::move(typeRenderer))
+    , m_genUtils(m_config)
+{
+}
+
+void WireFormat::index(std::vector<Class>& classes, const std::vector<Enum::Enum>& enums)
+{
+    m_project.clear();
+    select(classes, enums);
+    if (!m_config->wireFormat()) {
+        return;
+    }
+
+    for (const auto& c : classes) {
+        m_project.add(c.namespaces, c.name, {c.namespaces, c.name, false, c.hasWireFormat});
+    }
+    for (const auto& e : enums) {
+        m_project.add(e.namespaces, e.name, {e.namespaces, e.name, true});
+    }
+}
+
+void WireFormat::select(std::vector<Class>& classes, const std::vector<Enum::Enum>& enums)
+{
+    if (!m_config->wireFormat()) {
+        return;
+    }
+
+    m_types.clear();
+    for (auto& c : classes) {
+        m_types.add(c.namespaces, c.name, ModelType{&c, nullptr});
+    }
+    for (const auto& e : enums) {
+        m_types.add(e.namespaces, e.name, ModelType{nullptr, &e});
+    }
+
+    for (auto& c : classes) {
+        analyze(c.namespaces, "::" + Common::qualifiedName(c.namespaces, c.name));
+    }
+}
+
+File WireFormat::generate(const Class& c)
+{
+    const auto& indent = m_config->indent();
+    auto members       = publicMembers(c).value_or(std::vector<const Variable*>{});
+    std::string_view variablePrefix;
+    if (!m_config->noMemberPrefixForStructs()) {
+        variablePrefix = m_config->memberPrefix();
+    }
+
+    Common::CodeEmitter out(1024 + 128 * members.size());
+    out << "#pragma once\n\n";
+    out << "#include \"" << includePath(c.namespaces, c.name) << "\"\n";
+    out << "#include \"" << SupportHeaders::include("Wire", *m_config) << "\"\n";
+    for (const auto& inc : c.wireIncludes) {
+        out << "#include \"" << inc << "\"\n";
+    }
+    out << "\n";
+    m_genUtils.openNamespaces(out, c.namespaces);
+
+    out << "// " << c.name << " as read from the wire format, strings and vectors refer to the buffer\n";
+    out << "struct " << c.name << "View\n{\n";
+    for (const auto* var : members) {
+        out << indent << "Wire::View<" << m_typeRenderer->render(var->type) << "> " << var->name << ";\n";
+    }
+    out << "};\n\n";
+
+    out << "inline void wireWrite(Wire::Writer& out, const " << c.name << "& in) noexcept\n{\n";
+    for (const auto* var : members) {
+        out << indent << "Wire::put(out, in." << variablePrefix << var->name << ");\n";
+    }
+    out << "}\n\n";
+
+    out << "inline " << c.name << "View wireRead(Wire::Reader& in, Wire::Tag<" << c.name << ">) noexcept\n{\n";
+    out << indent << c.name << "View out;\n";
+    for (const auto* var : members) {
+        out << indent << "out." << var->name << " = Wire::get<" << m_typeRenderer->render(var->type) << ">(in);\n";
+    }
+    out << indent << "return out;\n}\n";
+
+    m_genUtils.closeNamespaces(out, c.namespaces);
+
+    auto nsPath =
+        std::accumulate(c.namespaces.begin(), c.namespaces.end(), fs::path(), [](const auto& a, const auto& b) {
+            return fs::path(a) / fs::path(b);
+        });
+    return {m_config->headersPath() / nsPath / (c.name + "Wire." + m_config->headerFileExtention()), out.str()};
+}
+
+WireFormat::ModelType* WireFormat::analyze(const std::list<std::string>& scope, const std::string& type)
+{
+    auto* model = m_types.find(scope, type);
+    // a struct that contains itself has no flat layout
+    if (!model || model->state != Common::VisitState::Pending) {
+        return model;
+    }
+    model->state = Common::VisitState::InProgress;
+
+    if (model->c) {
+        auto& c      = *model->c;
+        auto members = publicMembers(c);
+        bool wire    = c.isStruct && !c.isInterface && c.inherits.empty() && members && !members->empty();
+        std::set<std::string> includes;
+        for (const auto* var : members.value_or(std::vector<const Variable*>{})) {
+            const auto& t = var->type;
+            if (t.base == "std::string" || t.base == "std::string_view") {
+                wire &= t.templateParams.empty();
+            } else if (t.base == "std::vector") {
+                // std::vector<bool> packs its bits, there is no contiguous array of bools to write
+                wire &= t.templateParams.size() == 1 && t.templateParams[0].base != "bool" &&
+                        isScalar(c.namespaces, t.templateParams[0]);
+            } else if (!isScalar(c.namespaces, t)) {
+                auto* other = t.templateParams.empty() ? analyze(c.namespaces, t.base) : nullptr;
+                // a struct of another model
+                const auto* known = t.templateParams.empty() ? m_project.find(c.namespaces, t.base) : nullptr;
+                if (other && other->c) {
+                    wire &= other->hasWireFormat;
+                    includes.insert(includePath(other->c->namespaces, other->c->name + "Wire"));
+                } else if (known) {
+                    wire &= known->hasWireFormat;
+                    includes.insert(includePath(known->namespaces, known->name + "Wire"));
+                } else {
+                    wire = false;
+                }
+            }
+        }
+
+        model->hasWireFormat = wire;
+        c.hasWireFormat      = wire;
+        if (wire) {
+            c.wireIncludes = std::move(includes);
+        }
+    }
+
+    model->state = Common::VisitState::Done;
+    return model;
+}
+
+bool WireFormat::isScalar(const std::list<std::string>& scope, const Common::Type& type)
+{
+    if (!type.templateParams.empty()) {
+        return false;
+    }
+    if (m_config->wireScalarTypes().contains(type.base)) {
+        return true;
+    }
+    if (const auto* model = m_types.find(scope, type.base)) {
+        return model->e != nullptr;
+    }
+    const auto* known = m_project.find(scope, type.base);
+    return known && known->isEnum;
+}
+
+// from the headers folder, like the include of the support header Wire
+std::string WireFormat::includePath(const std::list<std::string>& namespaces, const std::string& name) const
+{
+    std::string path;
+    for (const auto& ns : namespaces) {
+        path += ns + "/";
+    }
+    return path + name + "." + m_config->headerFileExtention();
+}
+
+} // namespace Cpp::Class
@@ -0,0 +1,37 @@
+#include "Cpp/Common/CodeEmitter.h"
+
+namespace Cpp::Common {
+
+CodeEmitter::CodeEmitter(size_t expectedSize)
+{
+    m_buffer.reserve(expectedSize);
+}
+
+CodeEmitter& CodeEmitter::operator<<(std::string_view text)
+{
+    m_buffer.append(text.data(), text.data() + text.size());
+    return *this;
+}
+
+CodeEmitter& CodeEmitter::operator<<(char c)
+{
+    m_buffer.push_back(c);
+    return *this;
+}
+
+void CodeEmitter::reserve(size_t size)
+{
+    m_buffer.reserve(size);
+}
+
+size_t CodeEmitter::size() const
+{
+    return m_buffer.size();
+}
+
+std::string CodeEmitter::str() const
+{
+    return {m_buffer.data(), m_buffer.size()};
+}
+
+} // namespace Cpp::Common
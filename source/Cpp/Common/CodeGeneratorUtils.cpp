@@ -1,6 +1,6 @@
 #include "Cpp/Common/CodeGeneratorUtils.h"
 
-#include <numeric>
+#include <mutex>
 #include <ranges>
 #include <utility>
 
@@ -11,46 +11,49 @@ CodeGeneratorUtils::CodeGeneratorUtils(std::shared_ptr<Config> config)
 {
 }
 
-std::string CodeGeneratorUtils::openNamespaces(const std::list<std::string>& namespaces)
+void CodeGeneratorUtils::openNamespaces(CodeEmitter& out, const std::list<std::string>& namespaces)
 {
-    std::string ret;
-    if (m_config->concatenateNamespaces()) {
-        if (!namespaces.empty()) {
-            ret = "namespace ";
-            ret += std::accumulate(++namespaces.begin(),
-                                   namespaces.end(),
-                                   namespaces.front(),
-                                   [](const std::string& l, const std::string& r) { return l + "::" + r; });
-            ret += " {\n";
-        }
-    } else {
-        ret = std::accumulate(namespaces.begin(),
-                              namespaces.end(),
-                              std::string(),
-                              [](const std::string& l, const std::string& r) { return l + "namespace " + r + " {\n"; });
-    }
-    return ret;
+    out << namespaceBlock(namespaces).open;
+}
+
+void CodeGeneratorUtils::closeNamespaces(CodeEmitter& out, const std::list<std::string>& namespaces)
+{
+    out << namespaceBlock(namespaces).close;
 }
 
-std::string CodeGeneratorUtils::closeNamespaces(const std::list<std::string>& namespaces)
+const CodeGeneratorUtils::NamespaceBlock& CodeGeneratorUtils::namespaceBlock(const std::list<std::string>& namespaces)
 {
-    std::string ret;
+    {
+        std::shared_lock lock(m_mutex);
+        if (auto it = m_namespaceBlocks.find(namespaces); it != m_namespaceBlocks.end()) {
+            return it->second;
+        }
+    }
+
+    CodeEmitter open;
+    CodeEmitter close;
     if (m_config->concatenateNamespaces()) {
         if (!namespaces.empty()) {
-            ret = "} // namespace ";
-            ret += std::accumulate(++namespaces.begin(),
-                                   namespaces.end(),
-                                   namespaces.front(),
-                                   [](const std::string& l, const std::string& r) { return l + "::" + r; });
-            ret += "\n";
+            open << "namespace ";
+            open.join(namespaces, "::", [](CodeEmitter& o, const std::string& ns) { o << ns; });
+            open << " {\n";
+
+            close << "} // namespace ";
+            close.join(namespaces, "::", [](CodeEmitter& o, const std::string& ns) { o << ns; });
+            close << "\n";
         }
     } else {
-        ret = std::accumulate(
-            namespaces.rbegin(), namespaces.rend(), std::string(), [](const std::string& l, const std::string& r) {
-                return l + "} // namespace " + r + "\n";
-            });
+        for (const auto& ns : namespaces) {
+            open << "namespace " << ns << " {\n";
+        }
+        for (const auto& ns : namespaces | std::views::reverse) {
+            close << "} // namespace " << ns << "\n";
+        }
     }
-    return ret;
+
+    // map nodes don't move, so the block stays valid after the lock is released
+    std::unique_lock lock(m_mutex);
+    return m_namespaceBlocks.emplace(namespaces, NamespaceBlock{open.str(), close.str()}).first->second;
 }
 
 } // namespace Cpp::Common
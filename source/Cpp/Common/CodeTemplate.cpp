@@ -0,0 +1,78 @@
+#include "Cpp/Common/CodeTemplate.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace Cpp::Common {
+
+CodeTemplate::CodeTemplate(std::string_view text, const std::vector<std::string_view>& placeholders)
+{
+    while (!text.empty()) {
+        auto open  = text.find("{{");
+        auto close = open == std::string_view::npos ? open : text.find("}}", open + 2);
+        if (close == std::string_view::npos) {
+            addLiteral(text);
+            break;
+        }
+
+        addLiteral(text.substr(0, open));
+
+        auto name = text.substr(open + 2, close - open - 2);
+        if (auto it = std::ranges::find(placeholders, name); it != placeholders.end()) {
+            m_instructions.push_back({static_cast<size_t>(std::distance(placeholders.begin(), it))});
+        } else {
+            std::cout << "WARNING! Unknown placeholder in template: {{" << name << "}}" << std::endl;
+            addLiteral(text.substr(open, close + 2 - open));
+        }
+
+        text.remove_prefix(close + 2);
+    }
+}
+
+CodeTemplate CodeTemplate::fromFile(const std::filesystem::path& file,
+                                    std::string_view fallback,
+                                    const std::vector<std::string_view>& placeholders)
+{
+    if (!file.empty()) {
+        std::ifstream in(file, std::ios_base::in | std::ios_base::binary);
+        if (in.is_open()) {
+            std::stringstream text;
+            text << in.rdbuf();
+            return {text.str(), placeholders};
+        }
+        std::cout << "WARNING! Unable to read template " << file << ", using the built-in layout" << std::endl;
+    }
+
+    return {fallback, placeholders};
+}
+
+size_t CodeTemplate::literalSize() const
+{
+    return m_literals.size();
+}
+
+bool CodeTemplate::contains(size_t placeholder) const
+{
+    return std::ranges::any_of(m_instructions, [placeholder](const Instruction& instruction) {
+        return instruction.placeholder == placeholder;
+    });
+}
+
+void CodeTemplate::addLiteral(std::string_view text)
+{
+    if (text.empty()) {
+        return;
+    }
+
+    // consecutive literals are merged into one instruction
+    if (!m_instructions.empty() && m_instructions.back().placeholder == literal) {
+        m_instructions.back().length += text.size();
+    } else {
+        m_instructions.push_back({literal, m_literals.size(), text.size()});
+    }
+    m_literals += text;
+}
+
+} // namespace Cpp::Common
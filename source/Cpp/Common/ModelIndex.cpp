@@ -0,0 +1,14 @@
+#include "Cpp/Common/ModelIndex.h"
+
+namespace Cpp::Common {
+
+std::string qualifiedName(const std::list<std::string>& namespaces, const std::string& name)
+{
+    std::string result;
+    for (const auto& ns : namespaces) {
+        result += ns + "::";
+    }
+    return result + name;
+}
+
+} // namespace Cpp::Common
@@ -0,0 +1,95 @@
+#include "Cpp/Common/PerfectHash.h"
+
+#include <algorithm>
+#include <bit>
+#include <set>
+
+namespace Cpp::Common {
+
+namespace {
+
+// seeds to try for a bucket before the number of slots is doubled
+constexpr std::uint32_t seedsPerBucket = 1 << 16;
+
+// the top bits of the hash select one of size entries, at least two to keep the shift below 32
+std::uint32_t shiftFor(size_t size)
+{
+    return 32 - static_cast<std::uint32_t>(std::bit_width(std::max<size_t>(size, 2) - 1));
+}
+
+} // namespace
+
+std::optional<PerfectHash> PerfectHash::build(const std::vector<std::string_view>& keys)
+{
+    if (std::set<std::string_view>(keys.begin(), keys.end()).size() != keys.size()) {
+        return std::nullopt;
+    }
+
+    // about two keys per bucket, and slots for at least 25 % more than the keys so seeds are found quickly
+    PerfectHash result;
+    result.bucketShift = shiftFor((keys.size() + 1) / 2);
+    result.seeds.assign(size_t(1) << (32 - result.bucketShift), 0);
+
+    std::vector<std::vector<size_t>> buckets(result.seeds.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        buckets[hash(keys[i], 0) >> result.bucketShift].push_back(i);
+    }
+
+    // the fuller buckets are placed first, while most slots are still free
+    std::vector<size_t> order(buckets.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    for (result.slotShift = shiftFor(keys.size() + keys.size() / 4); result.slotShift > 0; --result.slotShift) {
+        result.slots.assign(size_t(1) << (32 - result.slotShift), 0);
+
+        bool placed = true;
+        for (auto b = order.begin(); b != order.end() && placed && !buckets[*b].empty(); ++b) {
+            placed = false;
+            for (std::uint32_t seed = 1; seed < seedsPerBucket && !placed; ++seed) {
+                std::vector<size_t> taken;
+                for (auto key : buckets[*b]) {
+                    auto slot = hash(keys[key], seed) >> result.slotShift;
+                    if (result.slots[slot] != 0 || std::find(taken.begin(), taken.end(), slot) != taken.end()) {
+                        break;
+                    }
+                    taken.push_back(slot);
+                }
+                if (taken.size() == buckets[*b].size()) {
+                    for (size_t i = 0; i < taken.size(); ++i) {
+                        result.slots[taken[i]] = buckets[*b][i] + 1;
+                    }
+                    result.seeds[*b] = seed;
+                    placed           = true;
+                }
+            }
+        }
+        if (placed) {
+            return result;
+        }
+    }
+    return std::nullopt;
+}
+
+std::uint32_t PerfectHash::hash(std::string_view key, std::uint32_t seed)
+{
+    std::uint32_t h = 2166136261u ^ seed;
+    for (char c : key) {
+        h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    h ^= h >> 15;
+    h *= 0x2c1b3c6du;
+    h ^= h >> 12;
+    return h;
+}
+
+size_t PerfectHash::find(std::string_view key) const
+{
+    return slots[hash(key, seeds[hash(key, 0) >> bucketShift]) >> slotShift];
+}
+
+} // namespace Cpp::Common
@@ -1,13 +1,69 @@
 #include "Cpp/Common/TranslatorUtils.h"
 
+#include <array>
 #include <cassert>
+#include <charconv>
+#include <iostream>
 #include <iterator>
 #include <numeric>
+#include <optional>
 #include <ranges>
 #include <utility>
 
+#include <fmt/core.h>
+
 namespace Cpp::Common {
 
+namespace {
+
+std::string_view trim(std::string_view s)
+{
+    auto begin = s.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    return s.substr(begin, s.find_last_not_of(" \t") - begin + 1);
+}
+
+struct Bounds
+{
+    size_t lower;
+    std::optional<size_t> upper; // unbounded if empty
+};
+
+// "n", "n..m", "n..*" and "*", anything else has no bounds
+std::optional<Bounds> parseCardinality(std::string_view cardinality)
+{
+    auto parseBound = [](std::string_view bound) -> std::optional<std::optional<size_t>> {
+        bound = trim(bound);
+        if (bound == "*") {
+            return std::optional<size_t>();
+        }
+        size_t value = 0;
+        auto [end, ec] = std::from_chars(bound.data(), bound.data() + bound.size(), value);
+        if (bound.empty() || ec != std::errc() || end != bound.data() + bound.size()) {
+            return std::nullopt;
+        }
+        return value;
+    };
+
+    auto separator = cardinality.find("..");
+    auto lower     = parseBound(cardinality.substr(0, separator));
+    auto upper     = separator == std::string_view::npos ? lower : parseBound(cardinality.substr(separator + 2));
+    if (!lower || !upper) {
+        return std::nullopt;
+    }
+
+    // a single "*" means any number, including none
+    return Bounds{lower->value_or(0), *upper};
+}
+
+// how an aggregation refers to its object, "shared" uses containerByCardinalityAggregation instead
+constexpr std::array<std::pair<std::string_view, std::string_view>, 4> aggregationPointers = {
+    {{"observer", "{}*"}, {"weak", "std::weak_ptr<{}>"}, {"intrusive", "IntrusivePtr<{}>"}, {"pool", "Handle<{}>"}}};
+
+} // namespace
+
 TranslatorUtils::TranslatorUtils(std::shared_ptr<Config> config)
     : m_config(std::move(config))
 {
@@ -41,7 +97,7 @@ Type TranslatorUtils::umlToCppType(PlantUml::Type umlType)
 Type TranslatorUtils::stringToCppType(std::string_view typeString)
 {
     auto pos = typeString.find_first_of(",<>");
-    Type ret{std::string(typeString.substr(0, pos))};
+    Type ret{std::string(trim(typeString.substr(0, pos)))};
 
     if (pos != std::string_view::npos) {
         if (typeString[pos] == '<') {
@@ -60,6 +116,61 @@ Type TranslatorUtils::stringToCppType(std::string_view typeString)
     return ret;
 }
 
+Type TranslatorUtils::compositionType(const std::string& cardinality, const std::string& type)
+{
+    if (auto it = m_config->containerByCardinalityComposition().find(cardinality);
+        it != m_config->containerByCardinalityComposition().end()) {
+        return stringToCppType(fmt::format(fmt::runtime(it->second), type));
+    }
+
+    auto bounds = parseCardinality(cardinality);
+    // exactly one element, or no bounds to go by
+    if (!bounds || (bounds->upper == bounds->lower && bounds->lower <= 1)) {
+        return Type{type};
+    }
+    if (!bounds->upper) {
+        return Type{"std::vector", {Type{type}}};
+    }
+
+    auto upper = *bounds->upper;
+    if (upper == 1) {
+        return Type{"std::optional", {Type{type}}};
+    }
+    if (upper == bounds->lower) {
+        return Type{"std::array", {Type{type}, Type{std::to_string(upper)}}};
+    }
+    // an inline container is opt-in, the usual ones aren't part of the standard library
+    if (!m_config->boundedContainer().empty() && upper <= m_config->maxInlineCapacity()) {
+        return stringToCppType(fmt::format(fmt::runtime(m_config->boundedContainer()), type, upper));
+    }
+    return Type{"std::vector", {Type{type}}};
+}
+
+Type TranslatorUtils::aggregationType(const std::string& cardinality,
+                                      const std::string& type,
+                                      const std::string& policy)
+{
+    auto pointer = std::ranges::find(aggregationPointers, policy, [](const auto& p) { return p.first; });
+    if (pointer == aggregationPointers.end() && policy != "shared" && m_unknownPolicies.insert(policy).second) {
+        std::cout << "WARNING! Unknown aggregation policy " << policy << ", using shared" << std::endl;
+    }
+    if (pointer == aggregationPointers.end()) {
+        if (auto it = m_config->containerByCardinalityAggregation().find(cardinality);
+            it != m_config->containerByCardinalityAggregation().end()) {
+            return stringToCppType(fmt::format(fmt::runtime(it->second), type));
+        }
+        return Type{type};
+    }
+
+    auto element = stringToCppType(fmt::format(fmt::runtime(pointer->second), type));
+
+    auto bounds = parseCardinality(cardinality);
+    if (bounds && (!bounds->upper || *bounds->upper > 1)) {
+        return Type{"std::vector", {element}};
+    }
+    return element;
+}
+
 std::string TranslatorUtils::visibilityToString(PlantUml::Visibility vis)
 {
     switch (vis) {
@@ -0,0 +1,89 @@
+#include "Cpp/Common/TypeLayout.h"
+
+#include <algorithm>
+#include <cctype>
+#include <utility>
+#include <vector>
+
+namespace Cpp::Common {
+
+namespace {
+
+constexpr Layout pointerLayout{8, 8};
+
+size_t roundUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+bool isNumber(const std::string& s)
+{
+    return !s.empty() && std::ranges::all_of(s, [](unsigned char c) { return std::isdigit(c); });
+}
+
+} // namespace
+
+TypeLayout::TypeLayout(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+{
+}
+
+std::optional<Layout> TypeLayout::layoutOf(const Type& type, const Resolver& resolve) const
+{
+    auto end = type.base.find_last_not_of(' ');
+    if (end == std::string::npos) {
+        return std::nullopt;
+    }
+    if (type.base[end] == '*' || type.base[end] == '&') {
+        return pointerLayout;
+    }
+    std::string base = type.base.substr(0, end + 1);
+
+    // templates whose layout depends on their parameters
+    const auto& params = type.templateParams;
+    if ((base == "std::optional" && params.size() == 1) || base == "std::pair" || base == "std::tuple") {
+        std::vector<Layout> members;
+        for (const auto& param : params) {
+            auto layout = layoutOf(param, resolve);
+            if (!layout) {
+                return std::nullopt;
+            }
+            members.push_back(*layout);
+        }
+        if (base == "std::optional") {
+            members.push_back({1, 1}); // engaged flag
+        }
+        return structLayout(members);
+    }
+    if (base == "std::array" && params.size() == 2 && isNumber(params[1].base)) {
+        auto element = layoutOf(params[0], resolve);
+        if (!element) {
+            return std::nullopt;
+        }
+        return Layout{element->size * std::stoul(params[1].base), element->alignment};
+    }
+
+    if (auto it = m_config->typeLayouts().find(base); it != m_config->typeLayouts().end()) {
+        return Layout{it->second[0], it->second[1]};
+    }
+
+    if (resolve) {
+        return resolve(base);
+    }
+    return std::nullopt;
+}
+
+Layout TypeLayout::structLayout(std::span<const Layout> members)
+{
+    Layout out;
+    for (const auto& member : members) {
+        out.size      = roundUp(out.size, member.alignment) + member.size;
+        out.alignment = std::max(out.alignment, member.alignment);
+    }
+
+    // even an empty struct occupies a byte
+    out.size = std::max<size_t>(roundUp(out.size, out.alignment), 1);
+    return out;
+}
+
+} // namespace Cpp::Common
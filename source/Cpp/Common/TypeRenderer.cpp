@@ -0,0 +1,105 @@
+#include "Cpp/Common/TypeRenderer.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <mutex>
+
+namespace Cpp::Common {
+
+namespace {
+
+constexpr size_t maxInlineParams = 8;
+
+} // namespace
+
+std::string_view TypeRenderer::render(const Type& type)
+{
+    return *intern(type);
+}
+
+TypeRenderer::Id TypeRenderer::intern(const Type& type)
+{
+    // template parameters are interned first, so a node is identified by its base and the ids of its parameters
+    if (type.templateParams.size() <= maxInlineParams) {
+        std::array<Id, maxInlineParams> params{};
+        std::ranges::transform(type.templateParams, params.begin(), [this](const Type& t) { return intern(t); });
+        return insert({type.base, std::span<const Id>(params.data(), type.templateParams.size())});
+    }
+
+    std::vector<Id> params;
+    params.reserve(type.templateParams.size());
+    std::ranges::transform(type.templateParams, std::back_inserter(params), [this](const Type& t) { return intern(t); });
+    return insert({type.base, params});
+}
+
+TypeRenderer::Id TypeRenderer::insert(NodeKey key)
+{
+    {
+        std::shared_lock lock(m_mutex);
+        if (auto it = m_ids.find(key); it != m_ids.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(m_mutex);
+    // another thread may have inserted the type in the meantime
+    if (auto it = m_ids.find(key); it != m_ids.end()) {
+        return it->second;
+    }
+
+    // new type: its spelling is composed from the already rendered spellings of its parameters
+    std::string spelling(key.base);
+    if (!key.templateParams.empty()) {
+        spelling += '<';
+        for (size_t i = 0; i < key.templateParams.size(); ++i) {
+            if (i > 0) {
+                spelling += ", ";
+            }
+            spelling += *key.templateParams[i];
+        }
+        spelling += '>';
+    }
+
+    Id id = &m_spellings.emplace_back(std::move(spelling));
+    m_ids.emplace(Node{std::string(key.base), {key.templateParams.begin(), key.templateParams.end()}}, id);
+
+    return id;
+}
+
+size_t TypeRenderer::NodeHash::operator()(const NodeKey& key) const
+{
+    size_t hash = std::hash<std::string_view>{}(key.base);
+    for (auto param : key.templateParams) {
+        hash ^= std::hash<Id>{}(param) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+size_t TypeRenderer::NodeHash::operator()(const Node& node) const
+{
+    return (*this)(NodeKey{node.base, node.templateParams});
+}
+
+bool TypeRenderer::NodeEqual::operator()(const NodeKey& l, const NodeKey& r) const
+{
+    return l.base == r.base && std::ranges::equal(l.templateParams, r.templateParams);
+}
+
+bool TypeRenderer::NodeEqual::operator()(const Node& l, const NodeKey& r) const
+{
+    return (*this)(NodeKey{l.base, l.templateParams}, r);
+}
+
+bool TypeRenderer::NodeEqual::operator()(const NodeKey& l, const Node& r) const
+{
+    return (*this)(l, NodeKey{r.base, r.templateParams});
+}
+
+bool TypeRenderer::NodeEqual::operator()(const Node& l, const Node& r) const
+{
+    return (*this)(NodeKey{l.base, l.templateParams}, NodeKey{r.base, r.templateParams});
+}
+
+} // namespace Cpp::Common
@@ -1,42 +1,284 @@
 #include "Cpp/Enum/HeaderGenerator.h"
 
-#include <algorithm>
-#include <numeric>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <utility>
+
+#include <fmt/core.h>
+
+#include "Cpp/Common/PerfectHash.h"
 
 namespace Cpp::Enum {
+
+namespace {
+
+enum class Placeholder
+{
+    Name,
+    Comment,
+    Includes,
+    NamespacesOpen,
+    NamespacesClose,
+    UnderlyingType,
+    Enumerators,
+    Definitions
+};
+
+const std::vector<std::string_view> placeholders = {"name",
+                                                    "comment",
+                                                    "includes",
+                                                    "namespacesOpen",
+                                                    "namespacesClose",
+                                                    "underlyingType",
+                                                    "enumerators",
+                                                    "definitions"};
+
+constexpr std::string_view builtInLayout = "#pragma once\n\n"
+                                           "{{includes}}"
+                                           "{{namespacesOpen}}"
+                                           "enum class {{name}}{{underlyingType}}{\n{{enumerators}}\n};"
+                                           "{{definitions}}"
+                                           "{{namespacesClose}}";
+
+// the smallest unsigned type that holds all values up to max
+std::string_view unsignedTypeFor(size_t max)
+{
+    if (max <= 0xff) {
+        return "std::uint8_t";
+    }
+    if (max <= 0xffff) {
+        return "std::uint16_t";
+    }
+    return "std::uint32_t";
+}
+
+} // namespace
+
 HeaderGenerator::HeaderGenerator(std::shared_ptr<Config> config)
     : m_config(std::move(config))
     , m_genUtils(m_config)
+    , m_template(Common::CodeTemplate::fromFile(m_config->enumHeaderTemplate(), builtInLayout, placeholders))
 {
 }
 
 std::string HeaderGenerator::generate(const Enum& in)
 {
-    std::string ret;
+    // the reflection repeats every enumerator a few times
+    size_t perEnumerator = m_config->enumReflection() ? 160 : 32;
+    Common::CodeEmitter out(m_template.literalSize() + 64 + perEnumerator * in.enumerators.size());
+
+    m_template.render(out, [this, &in](Common::CodeEmitter& o, size_t placeholder) {
+        switch (static_cast<Placeholder>(placeholder)) {
+        case Placeholder::Name:
+            o << in.name;
+            break;
+        case Placeholder::Comment:
+            o << in.comment;
+            break;
+        case Placeholder::Includes:
+            generateIncludes(o, in);
+            break;
+        case Placeholder::NamespacesOpen:
+            m_genUtils.openNamespaces(o, in.namespaces);
+            break;
+        case Placeholder::NamespacesClose:
+            m_genUtils.closeNamespaces(o, in.namespaces);
+            break;
+        case Placeholder::UnderlyingType:
+            if (!in.underlyingType.empty()) {
+                o << " : " << in.underlyingType;
+            }
+            break;
+        case Placeholder::Enumerators:
+            o.join(in.enumerators, ",\n", [this](Common::CodeEmitter& e, const Enumerator& enumerator) {
+                e << m_config->indent() << enumerator.name;
+                if (enumerator.value) {
+                    e << " = " << std::to_string(*enumerator.value);
+                }
+            });
+            break;
+        case Placeholder::Definitions:
+            generateDefinitions(o, in);
+            break;
+        }
+    });
+
+    return out.str();
+}
+
+bool HeaderGenerator::reflects(const Enum& in) const
+{
+    return m_config->enumReflection() && !in.enumerators.empty();
+}
+
+bool HeaderGenerator::isFlags(const Enum& in) const
+{
+    return in.stereotype == "Flags";
+}
+
+void HeaderGenerator::generateIncludes(Common::CodeEmitter& out, const Enum& in) const
+{
+    std::set<std::string_view> includes;
+    if (in.underlyingType.starts_with("std::") && in.underlyingType.ends_with("_t")) {
+        includes.insert("cstdint");
+    }
+    if (isFlags(in)) {
+        includes.insert("type_traits");
+    }
+    if (reflects(in)) {
+        includes.insert({"array", "cstddef", "cstdint", "optional", "string_view"});
+    }
 
-    // pragme once
-    ret += "#pragma once\n\n";
+    for (auto include : includes) {
+        out << "#include <" << include << ">\n";
+    }
+    if (!includes.empty()) {
+        out << "\n";
+    }
+}
 
-    // open namespaces
-    ret += m_genUtils.openNamespaces(in.namespaces);
+void HeaderGenerator::generateDefinitions(Common::CodeEmitter& out, const Enum& in) const
+{
+    // the enum ends without a line break, every following section starts after a blank line
+    if (isFlags(in) || reflects(in)) {
+        out << "\n";
+    }
+    if (isFlags(in)) {
+        out << "\n";
+        generateFlagOperators(out, in);
+    }
+    if (reflects(in)) {
+        out << "\n";
+        generateReflection(out, in);
+    }
+}
 
-    // variant definition
-    ret += "enum class " + in.name + "{\n";
+void HeaderGenerator::generateFlagOperators(Common::CodeEmitter& out, const Enum& in) const
+{
+    const auto& indent = m_config->indent();
+    const auto& name   = in.name;
+    const auto cast    = [&name](std::string_view operand) {
+        return "static_cast<std::underlying_type_t<" + name + ">>(" + std::string(operand) + ")";
+    };
 
-    if (!in.enumerators.empty()) {
-        ret += std::accumulate(
-            ++in.enumerators.begin(),
-            in.enumerators.end(),
-            m_config->indent() + in.enumerators.front().name,
-            [this](const std::string& l, const Enumerator& r) { return l + ",\n" + m_config->indent() + r.name; });
+    // ~ only flips the bits of the flags, so the complement of all flags is empty
+    std::int64_t all = 0;
+    for (auto value : values(in)) {
+        all |= value;
     }
 
-    ret += "\n};";
+    for (std::string_view op : {"|", "&", "^"}) {
+        out << "constexpr " << name << " operator" << op << "(" << name << " lhs, " << name << " rhs)\n{\n";
+        out << indent << "return static_cast<" << name << ">(" << cast("lhs") << " " << op << " " << cast("rhs")
+            << ");\n";
+        out << "}\n";
+    }
+    out << "constexpr " << name << " operator~(" << name << " value)\n{\n";
+    out << indent << "return static_cast<" << name << ">(~" << cast("value") << " & "
+        << cast(fmt::format("{:#x}u", static_cast<std::uint64_t>(all))) << ");\n";
+    out << "}\n";
+    for (std::string_view op : {"|", "&", "^"}) {
+        out << "constexpr " << name << "& operator" << op << "=(" << name << "& lhs, " << name << " rhs)\n{\n";
+        out << indent << "return lhs = lhs " << op << " rhs;\n";
+        out << "}\n";
+    }
+    out << "\n";
+
+    out << "// true if all flags of flag are set in value\n";
+    out << "constexpr bool hasFlag(" << name << " value, " << name << " flag)\n{\n";
+    out << indent << "return (value & flag) == flag;\n";
+    out << "}\n";
+    out << "// true if one of the flags is set in value\n";
+    out << "constexpr bool hasAnyFlag(" << name << " value, " << name << " flags)\n{\n";
+    out << indent << "return " << cast("value & flags") << " != 0;\n";
+    out << "}\n";
+}
+
+void HeaderGenerator::generateReflection(Common::CodeEmitter& out, const Enum& in) const
+{
+    const auto& indent = m_config->indent();
+    const auto& name   = in.name;
+
+    out << "constexpr std::size_t " << name << "Count = " << std::to_string(in.enumerators.size()) << ";\n\n";
 
-    // close namespaces
-    ret += m_genUtils.closeNamespaces(in.namespaces);
+    out << "constexpr std::array<std::string_view, " << name << "Count> " << name << "Names = {";
+    out.join(in.enumerators, ", ", [](Common::CodeEmitter& o, const Enumerator& e) { o << '"' << e.name << '"'; });
+    out << "};\n";
+    out << "constexpr std::array<" << name << ", " << name << "Count> " << name << "Values = {";
+    out.join(in.enumerators, ", ", [&name](Common::CodeEmitter& o, const Enumerator& e) {
+        o << name << "::" << e.name;
+    });
+    out << "};\n\n";
 
-    return ret;
+    out << "constexpr std::string_view toString(" << name << " value)\n{\n";
+    auto enumeratorValues = values(in);
+    bool numberedFromZero = true;
+    for (size_t i = 0; i < enumeratorValues.size(); ++i) {
+        numberedFromZero = numberedFromZero && enumeratorValues[i] == static_cast<std::int64_t>(i);
+    }
+    if (numberedFromZero) {
+        // the value is the index into the name table
+        out << indent << "auto index = static_cast<std::size_t>(value);\n";
+        out << indent << "return index < " << name << "Count ? " << name << "Names[index] : std::string_view();\n";
+    } else {
+        // enumerators sharing a value have the name of the first one
+        std::set<std::int64_t> seen;
+        out << indent << "switch (value) {\n";
+        for (size_t i = 0; i < in.enumerators.size(); ++i) {
+            if (seen.insert(enumeratorValues[i]).second) {
+                out << indent << "case " << name << "::" << in.enumerators[i].name << ":\n";
+                out << indent << indent << "return " << name << "Names[" << std::to_string(i) << "];\n";
+            }
+        }
+        out << indent << "}\n";
+        out << indent << "return std::string_view();\n";
+    }
+    out << "}\n";
+
+    std::vector<std::string_view> keys;
+    for (const auto& e : in.enumerators) {
+        keys.push_back(e.name);
+    }
+    auto hash = Common::PerfectHash::build(keys);
+
+    out << "\nconstexpr std::optional<" << name << "> " << name << "FromString(std::string_view name)\n{\n";
+    if (!hash) {
+        // duplicate names or no seeds found, the first enumerator with the name wins
+        out << indent << "for (std::size_t i = 0; i < " << name << "Count; ++i) {\n";
+        out << indent << indent << "if (" << name << "Names[i] == name) {\n";
+        out << indent << indent << indent << "return " << name << "Values[i];\n";
+        out << indent << indent << "}\n";
+        out << indent << "}\n";
+        out << indent << "return std::nullopt;\n";
+        out << "}\n";
+        return;
+    }
+    out << indent << "// perfect hash of the names: the first hash selects a bucket, the seed of the bucket\n";
+    out << indent << "// the slot, the slots hold the index of the enumerator plus one\n";
+    out << indent << "constexpr std::array<std::uint32_t, " << std::to_string(hash->seeds.size()) << "> seeds = {";
+    out.join(hash->seeds, ", ", [](Common::CodeEmitter& o, std::uint32_t seed) { o << std::to_string(seed) << "u"; });
+    out << "};\n";
+    out << indent << "constexpr std::array<" << unsignedTypeFor(in.enumerators.size()) << ", "
+        << std::to_string(hash->slots.size()) << "> slots = {";
+    out.join(hash->slots, ", ", [](Common::CodeEmitter& o, size_t slot) { o << std::to_string(slot); });
+    out << "};\n";
+    out << indent << "constexpr auto hash = [](std::string_view s, std::uint32_t seed) {\n";
+    out << indent << indent << "std::uint32_t h = 2166136261u ^ seed;\n";
+    out << indent << indent << "for (char c : s) {\n";
+    out << indent << indent << indent << "h = (h ^ static_cast<unsigned char>(c)) * 16777619u;\n";
+    out << indent << indent << "}\n";
+    out << indent << indent << "h ^= h >> 15;\n";
+    out << indent << indent << "h *= 0x2c1b3c6du;\n";
+    out << indent << indent << "return h ^ (h >> 12);\n";
+    out << indent << "};\n\n";
+    out << indent << "auto slot = slots[hash(name, seeds[hash(name, 0) >> " << std::to_string(hash->bucketShift)
+        << "u]) >> " << std::to_string(hash->slotShift) << "u];\n";
+    out << indent << "if (slot == 0 || " << name << "Names[slot - 1] != name) {\n";
+    out << indent << indent << "return std::nullopt;\n";
+    out << indent << "}\n";
+    out << indent << "return " << name << "Values[slot - 1];\n";
+    out << "}\n";
 }
 
 } // namespace Cpp::Enum
@@ -1,8 +1,65 @@
 #include "Cpp/Enum/Translator.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+
 #include "Common/LogHelpers.h"
 
 namespace Cpp::Enum {
+
+namespace {
+
+// the smallest fixed width integer type holding all values, unsigned unless a value is negative
+std::string smallestType(const std::vector<std::int64_t>& values)
+{
+    auto [min, max] = values.empty() ? std::pair<std::int64_t, std::int64_t>{0, 0}
+                                     : std::pair{*std::ranges::min_element(values), *std::ranges::max_element(values)};
+    if (min < 0) {
+        if (min >= std::numeric_limits<std::int8_t>::min() && max <= std::numeric_limits<std::int8_t>::max()) {
+            return "std::int8_t";
+        }
+        if (min >= std::numeric_limits<std::int16_t>::min() && max <= std::numeric_limits<std::int16_t>::max()) {
+            return "std::int16_t";
+        }
+        if (min >= std::numeric_limits<std::int32_t>::min() && max <= std::numeric_limits<std::int32_t>::max()) {
+            return "std::int32_t";
+        }
+        return "std::int64_t";
+    }
+    if (max <= std::numeric_limits<std::uint8_t>::max()) {
+        return "std::uint8_t";
+    }
+    if (max <= std::numeric_limits<std::uint16_t>::max()) {
+        return "std::uint16_t";
+    }
+    if (max <= std::numeric_limits<std::uint32_t>::max()) {
+        return "std::uint32_t";
+    }
+    return "std::uint64_t";
+}
+
+// flags without a value get the next bit above the previous flags, the values are std::int64_t so bit 62 is the last
+void assignFlagValues(Enum& en)
+{
+    int bit = 0;
+    for (auto& enumerator : en.enumerators) {
+        if (enumerator.value) {
+            while (bit < 63 && (std::int64_t(1) << bit) <= *enumerator.value) {
+                ++bit;
+            }
+        } else if (bit < 63) {
+            enumerator.value = std::int64_t(1) << bit++;
+        } else {
+            std::cout << "ERROR! No bit left for flag " << en.name << "::" << enumerator.name
+                      << ", flags have the bits 0 to 62" << std::endl;
+        }
+    }
+}
+
+} // namespace
 Translator::Translator(std::shared_ptr<Config> config)
     : m_config(std::move(config))
     , m_utils(m_config)
@@ -45,6 +102,7 @@ bool Translator::visit(const PlantUml::Element& e)
     if (e.type == PlantUml::ElementType::Enum) {
         Enum en;
         en.name       = e.name.back();
+        en.stereotype = e.stereotype;
         en.namespaces = m_namespaceStack;
         en.namespaces.insert(en.namespaces.end(), e.name.begin(), e.name.end());
         en.namespaces.pop_back();
@@ -73,7 +131,13 @@ bool Translator::visit(const PlantUml::Enumerator& e)
     FuncTracer f_;
 
     if (m_lastEncountered != m_results.end()) {
-        m_lastEncountered->enumerators.emplace_back(e.name);
+        Enumerator enumerator{e.name};
+        std::int64_t value = 0;
+        auto last          = e.value.data() + e.value.size();
+        if (!e.value.empty() && std::from_chars(e.value.data(), last, value).ptr == last) {
+            enumerator.value = value;
+        }
+        m_lastEncountered->enumerators.push_back(std::move(enumerator));
     }
 
     return false;
@@ -106,6 +170,17 @@ bool Translator::visit(const PlantUml::Type& t)
 
 std::vector<Enum> Translator::results() &&
 {
+    const auto& underlyingType = m_config->enumUnderlyingType();
+    for (auto& en : m_results) {
+        // flags always fit into the smallest type, unless a type is configured explicitly
+        bool flags = en.stereotype == "Flags";
+        if (flags) {
+            assignFlagValues(en);
+        }
+        bool smallest     = underlyingType == "auto" || (flags && underlyingType.empty());
+        en.underlyingType = smallest ? smallestType(values(en)) : underlyingType;
+    }
+
     return m_results;
 }
 
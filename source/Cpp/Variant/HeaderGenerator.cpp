@@ -1,53 +1,269 @@
 #include "Cpp/Variant/HeaderGenerator.h"
 
 #include <algorithm>
-#include <numeric>
-#include <ranges>
+#include <cctype>
+#include <string>
+#include <utility>
 
 namespace Cpp::Variant {
 
-HeaderGenerator::HeaderGenerator(std::shared_ptr<Config> config)
+namespace {
+
+enum class Placeholder
+{
+    Name,
+    Comment,
+    Includes,
+    NamespacesOpen,
+    NamespacesClose,
+    Alternatives,
+    Definitions
+};
+
+const std::vector<std::string_view> placeholders = {
+    "name", "comment", "includes", "namespacesOpen", "namespacesClose", "alternatives", "definitions"};
+
+constexpr std::string_view builtInLayout = "#pragma once\n\n"
+                                           "#include <variant>\n\n"
+                                           "{{includes}}\n"
+                                           "{{namespacesOpen}}\n"
+                                           "using {{name}} = std::variant<{{alternatives}}>;\n\n"
+                                           "{{definitions}}"
+                                           "{{namespacesClose}}";
+
+// compact variants are classes of their own, so the template for std::variant doesn't apply
+constexpr std::string_view taggedUnionLayout = "#pragma once\n\n"
+                                               "#include <cstdint>\n"
+                                               "#include <type_traits>\n"
+                                               "#include <utility>\n\n"
+                                               "{{includes}}\n"
+                                               "{{namespacesOpen}}\n"
+                                               "{{definitions}}"
+                                               "{{namespacesClose}}";
+
+// the name of each alternative in the index enum, the position is appended where names repeat
+std::vector<std::string> alternativeNames(const Variant& in)
+{
+    std::vector<std::string> names;
+    for (const auto& type : in.containedTypes) {
+        auto pos = type.base.rfind("::");
+        names.push_back(pos == std::string::npos ? type.base : type.base.substr(pos + 2));
+    }
+    auto result = names;
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (std::count(names.begin(), names.end(), names[i]) > 1 || names[i].empty()) {
+            result[i] += std::to_string(i);
+        }
+    }
+    return result;
+}
+
+std::string lowerFirst(std::string s)
+{
+    if (!s.empty()) {
+        s[0] = static_cast<char>(std::tolower(static_cast<unsigned char>(s[0])));
+    }
+    return s;
+}
+
+} // namespace
+
+HeaderGenerator::HeaderGenerator(std::shared_ptr<Config> config,
+                                 std::shared_ptr<Common::TypeRenderer> typeRenderer)
     : m_config(std::move(config))
     , m_genUtils(m_config)
+    , m_typeRenderer(std::move(typeRenderer))
+    , m_template(Common::CodeTemplate::fromFile(m_config->variantHeaderTemplate(), builtInLayout, placeholders))
+    , m_taggedUnionTemplate(taggedUnionLayout, placeholders)
 {
 }
 
 std::string HeaderGenerator::generate(const Variant& in)
 {
-    std::string ret;
+    // the dispatch helpers and tagged unions repeat every alternative a few times
+    size_t perAlternative = m_config->variantDispatch() || in.isTaggedUnion ? 512 : 48;
+    Common::CodeEmitter out(m_template.literalSize() + 64 + perAlternative * in.containedTypes.size());
 
-    // pragme once
-    ret += "#pragma once\n\n";
+    const auto& layout = in.isTaggedUnion ? m_taggedUnionTemplate : m_template;
+    layout.render(out, [this, &in](Common::CodeEmitter& o, size_t placeholder) {
+        switch (static_cast<Placeholder>(placeholder)) {
+        case Placeholder::Name:
+            o << in.name;
+            break;
+        case Placeholder::Comment:
+            o << in.comment;
+            break;
+        case Placeholder::Includes:
+            if (dispatches(in)) {
+                o << "#include <cstddef>\n"
+                  << "#include <type_traits>\n"
+                  << "#include <utility>\n\n";
+            }
+            for (const auto& inc : in.containedTypes) {
+                o << "#include \"" << inc.base << ".h\"\n";
+            }
+            break;
+        case Placeholder::NamespacesOpen:
+            m_genUtils.openNamespaces(o, in.namespaces);
+            break;
+        case Placeholder::NamespacesClose:
+            m_genUtils.closeNamespaces(o, in.namespaces);
+            break;
+        case Placeholder::Alternatives:
+            o.join(in.containedTypes, ", ", [this](Common::CodeEmitter& e, const Common::Type& t) {
+                e << m_typeRenderer->render(t);
+            });
+            break;
+        case Placeholder::Definitions:
+            if (in.isTaggedUnion) {
+                generateTaggedUnion(o, in);
+            } else if (dispatches(in)) {
+                generateDispatch(o, in);
+            }
+            break;
+        }
+    });
 
-    // include std::variant
-    ret += "#include <variant>\n\n";
+    return out.str();
+}
 
-    // other includes
-    auto incs = in.containedTypes |
-                std::views::transform([](const Common::Type& inc) { return "#include \"" + inc.base + ".h\"\n"; });
-    ret += std::accumulate(incs.begin(), incs.end(), std::string());
-    ret += "\n";
+bool HeaderGenerator::dispatches(const Variant& in) const
+{
+    // tagged unions have an index and a visit function of their own
+    return m_config->variantDispatch() && !in.containedTypes.empty() && !in.isTaggedUnion;
+}
 
-    // open namespaces
-    ret += m_genUtils.openNamespaces(in.namespaces) + "\n";
+void HeaderGenerator::generateDispatch(Common::CodeEmitter& out, const Variant& in)
+{
+    const auto& indent = m_config->indent();
+    const auto& name   = in.name;
+    auto names         = alternativeNames(in);
+
+    out << "enum class " << name << "Index : std::size_t\n{\n";
+    out.join(names, ",\n", [&indent](Common::CodeEmitter& o, const std::string& n) { o << indent << n; });
+    out << "\n};\n\n";
+
+    // alternatives appearing more than once have no unique index
+    std::vector<std::string> types;
+    for (const auto& type : in.containedTypes) {
+        types.emplace_back(m_typeRenderer->render(type));
+    }
+    out << "template <typename T>\nstruct " << name << "IndexOf;\n";
+    for (size_t i = 0; i < types.size(); ++i) {
+        if (std::count(types.begin(), types.end(), types[i]) == 1) {
+            out << "template <>\nstruct " << name << "IndexOf<" << types[i] << "> : std::integral_constant<" << name
+                << "Index, " << name << "Index::" << names[i] << ">\n{\n};\n";
+        }
+    }
+    out << "\n";
+
+    out << "constexpr " << name << "Index indexOf(const " << name << "& value)\n{\n";
+    out << indent << "return static_cast<" << name << "Index>(value.index());\n";
+    out << "}\n\n";
+
+    // a switch with one case per alternative instead of std::visit, so the dispatch becomes a single jump table, the
+    // index check of std::get folds away as the index is known in each case
+    for (std::string_view constness : {"", "const "}) {
+        out << "template <typename F>\n";
+        out << "constexpr decltype(auto) visit" << name << "(F&& f, " << constness << name << "& value)\n{\n";
+        out << indent << "switch (value.index()) {\n";
+        for (size_t i = 0; i < types.size(); ++i) {
+            out << indent << "case " << std::to_string(i) << ":\n";
+            out << indent << indent << "return std::forward<F>(f)(std::get<" << std::to_string(i) << ">(value));\n";
+        }
+        out << indent << "default:\n";
+        out << indent << indent << "throw std::bad_variant_access();\n";
+        out << indent << "}\n";
+        out << "}\n";
+    }
+    out << "\n";
+}
 
-    // variant definition
-    ret += "using " + in.name + " = std::variant<";
+void HeaderGenerator::generateTaggedUnion(Common::CodeEmitter& out, const Variant& in)
+{
+    const auto& indent = m_config->indent();
+    const auto& name   = in.name;
+    auto names         = alternativeNames(in);
+    // the storage is named independently of the member prefix, so it can't clash with the accessors
+    std::string index = "m_index";
 
-    if (!in.containedTypes.empty()) {
-        ret += std::accumulate(++in.containedTypes.begin(),
+    std::vector<std::string> types;
+    std::vector<std::string> members;
+    for (size_t i = 0; i < in.containedTypes.size(); ++i) {
+        types.emplace_back(m_typeRenderer->render(in.containedTypes[i]));
+        members.push_back("m_storage" + names[i]);
+    }
 
-                               in.containedTypes.end(),
-                               in.containedTypes.front().base,
-                               [](const std::string& l, const Common::Type& r) { return l + ", " + r.base; });
+    out << "// tagged union of trivially copyable alternatives";
+    if (in.estimatedSize) {
+        out << ", estimated sizeof: " << std::to_string(*in.estimatedSize) << " bytes";
     }
+    out << "\nclass " << name << "\n{\npublic:\n";
 
-    ret += ">;\n\n";
+    out << indent << "enum class Index : " << (types.size() <= 256 ? "std::uint8_t" : "std::uint16_t") << "\n";
+    out << indent << "{\n";
+    out.join(names, ",\n", [&indent](Common::CodeEmitter& o, const std::string& n) { o << indent << indent << n; });
+    out << "\n" << indent << "};\n\n";
 
-    // close namespaces
-    ret += m_genUtils.closeNamespaces(in.namespaces);
+    // like std::variant, a default constructed union holds the first alternative
+    out << indent << "constexpr " << name << "()\n";
+    out << indent << indent << ": " << members[0] << "()\n";
+    out << indent << "{\n" << indent << "}\n";
+    for (size_t i = 0; i < types.size(); ++i) {
+        out << indent << "constexpr " << name << "(const " << types[i] << "& value)\n";
+        out << indent << indent << ": " << members[i] << "(value)\n";
+        out << indent << indent << ", " << index << "(Index::" << names[i] << ")\n";
+        out << indent << "{\n" << indent << "}\n";
+    }
+    out << "\n";
+
+    out << indent << "constexpr Index index() const\n" << indent << "{\n";
+    out << indent << indent << "return " << index << ";\n";
+    out << indent << "}\n";
+    for (size_t i = 0; i < types.size(); ++i) {
+        auto accessor = lowerFirst(names[i]);
+        out << "\n";
+        out << indent << "constexpr bool is" << names[i] << "() const\n" << indent << "{\n";
+        out << indent << indent << "return " << index << " == Index::" << names[i] << ";\n";
+        out << indent << "}\n";
+        out << indent << "constexpr const " << types[i] << "& " << accessor << "() const\n" << indent << "{\n";
+        out << indent << indent << "return " << members[i] << ";\n";
+        out << indent << "}\n";
+        out << indent << "constexpr " << types[i] << "& " << accessor << "()\n" << indent << "{\n";
+        out << indent << indent << "return " << members[i] << ";\n";
+        out << indent << "}\n";
+        out << indent << "constexpr void set(const " << types[i] << "& value)\n" << indent << "{\n";
+        out << indent << indent << members[i] << " = value;\n";
+        out << indent << indent << index << " = Index::" << names[i] << ";\n";
+        out << indent << "}\n";
+    }
+
+    // one case per alternative, the last one is the default so every path returns
+    for (std::string_view constness : {" const", ""}) {
+        out << "\n";
+        out << indent << "template <typename F>\n";
+        out << indent << "constexpr decltype(auto) visit(F&& f)" << constness << "\n" << indent << "{\n";
+        out << indent << indent << "switch (" << index << ") {\n";
+        for (size_t i = 0; i + 1 < types.size(); ++i) {
+            out << indent << indent << "case Index::" << names[i] << ":\n";
+            out << indent << indent << indent << "return std::forward<F>(f)(" << members[i] << ");\n";
+        }
+        out << indent << indent << "default:\n";
+        out << indent << indent << indent << "return std::forward<F>(f)(" << members.back() << ");\n";
+        out << indent << indent << "}\n";
+        out << indent << "}\n";
+    }
+
+    out << "\nprivate:\n";
+    out << indent << "union\n" << indent << "{\n";
+    for (size_t i = 0; i < types.size(); ++i) {
+        out << indent << indent << types[i] << " " << members[i] << ";\n";
+    }
+    out << indent << "};\n";
+    out << indent << "Index " << index << " = Index::" << names[0] << ";\n";
+    out << "};\n\n";
 
-    return ret;
+    out << "static_assert(std::is_trivially_copyable_v<" << name << ">);\n\n";
 }
 
 } // namespace Cpp::Variant
@@ -0,0 +1,153 @@
+#include "Cpp/Variant/TaggedUnions.h"
+
+#include <algorithm>
+#include <utility>
+#include <variant>
+
+namespace Cpp::Variant {
+
+namespace {
+
+// the union declares the enum Index and index(), they would hide an alternative Index or its accessor index()
+bool hasReservedName(const Common::Type& type)
+{
+    auto pos  = type.base.rfind("::");
+    auto name = pos == std::string::npos ? type.base : type.base.substr(pos + 2);
+    return name == "Index" || name == "index";
+}
+
+} // namespace
+
+TaggedUnions::TaggedUnions(std::shared_ptr<Config> config)
+    : m_config(std::move(config))
+    , m_typeLayout(m_config)
+{
+}
+
+void TaggedUnions::select(std::vector<Variant>& variants,
+                          const std::vector<Class::Class>& classes,
+                          const std::vector<Enum::Enum>& enums)
+{
+    if (!m_config->compactVariants()) {
+        return;
+    }
+
+    m_types.clear();
+    for (const auto& c : classes) {
+        m_types.add(c.namespaces, c.name, ModelType{&c, nullptr});
+    }
+    for (const auto& e : enums) {
+        m_types.add(e.namespaces, e.name, ModelType{nullptr, &e});
+    }
+
+    for (auto& v : variants) {
+        const auto& types = v.containedTypes;
+
+        bool compact = !types.empty() && std::ranges::none_of(types, hasReservedName);
+        std::vector<Common::Layout> layouts;
+        for (const auto& type : types) {
+            auto* model = type.templateParams.empty() ? analyze(v.namespaces, type.base) : nullptr;
+            compact &= model && model->c && model->triviallyCopyable && std::ranges::count(types, type) == 1;
+            if (model && model->layout) {
+                layouts.push_back(*model->layout);
+            }
+        }
+        if (!compact) {
+            continue;
+        }
+
+        v.isTaggedUnion = true;
+        if (layouts.size() == types.size()) {
+            // the alternatives share their storage, the index follows in what would otherwise be padding
+            Common::Layout storage{std::ranges::max(layouts, {}, &Common::Layout::size).size,
+                                   std::ranges::max(layouts, {}, &Common::Layout::alignment).alignment};
+            Common::Layout index = types.size() <= 256 ? Common::Layout{1, 1} : Common::Layout{2, 2};
+            std::vector<Common::Layout> members{storage, index};
+            v.estimatedSize = Common::TypeLayout::structLayout(members).size;
+        }
+    }
+}
+
+TaggedUnions::ModelType* TaggedUnions::analyze(const std::list<std::string>& scope, const std::string& type)
+{
+    auto* model = m_types.find(scope, type);
+    // a type that contains itself can't be copied anyway
+    if (!model || model->state != Common::VisitState::Pending) {
+        return model;
+    }
+    model->state = Common::VisitState::InProgress;
+
+    if (model->e) {
+        Common::Type underlyingType{model->e->underlyingType.empty() ? "int" : model->e->underlyingType};
+        model->triviallyCopyable = true;
+        model->layout            = m_typeLayout.layoutOf(underlyingType);
+    } else {
+        const auto& c = *model->c;
+        bool trivial  = !c.isInterface;
+        bool known    = true;
+        std::vector<Common::Layout> layouts;
+        auto add = [&layouts, &known](const std::optional<Common::Layout>& layout) {
+            known &= layout.has_value();
+            layouts.push_back(layout.value_or(Common::Layout{}));
+        };
+
+        for (const auto& base : c.inherits) {
+            auto* other = analyze(c.namespaces, base);
+            trivial &= other && other->triviallyCopyable;
+            add(other ? other->layout : std::nullopt);
+        }
+        for (const auto& elem : c.body) {
+            if (std::holds_alternative<Class::Method>(elem)) {
+                trivial &= !std::get<Class::Method>(elem).isAbstract;
+            } else if (std::holds_alternative<Class::Variable>(elem) && !std::get<Class::Variable>(elem).isStatic) {
+                const auto& var = std::get<Class::Variable>(elem);
+                trivial &= triviallyCopyable(c.namespaces, var.type);
+                add(layoutOf(c.namespaces, var.type));
+            }
+        }
+
+        model->triviallyCopyable = trivial;
+        if (known) {
+            model->layout = Common::TypeLayout::structLayout(layouts);
+        }
+    }
+
+    model->state = Common::VisitState::Done;
+    return model;
+}
+
+bool TaggedUnions::triviallyCopyable(const std::list<std::string>& scope, const Common::Type& type)
+{
+    auto end = type.base.find_last_not_of(' ');
+    if (end == std::string::npos || type.base[end] == '&') {
+        return false;
+    }
+    if (type.base[end] == '*') {
+        return true;
+    }
+
+    std::string base   = type.base.substr(0, end + 1);
+    const auto& params = type.templateParams;
+    if ((base == "std::array" && params.size() == 2) || (base == "std::optional" && params.size() == 1)) {
+        return triviallyCopyable(scope, params[0]);
+    }
+    if (!params.empty()) {
+        return false;
+    }
+    if (m_config->triviallyCopyableTypes().contains(base)) {
+        return true;
+    }
+
+    auto* model = analyze(scope, base);
+    return model && model->triviallyCopyable;
+}
+
+std::optional<Common::Layout> TaggedUnions::layoutOf(const std::list<std::string>& scope, const Common::Type& type)
+{
+    return m_typeLayout.layoutOf(type, [this, &scope](const std::string& name) -> std::optional<Common::Layout> {
+        auto* model = analyze(scope, name);
+        return model ? model->layout : std::nullopt;
+    });
+}
+
+} // namespace Cpp::Variant
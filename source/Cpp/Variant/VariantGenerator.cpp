@@ -2,14 +2,19 @@
 
 #include <numeric>
 
+#include "Cpp/Class/Translator.h"
+#include "Cpp/Enum/Translator.h"
+
 #include <filesystem>
 namespace fs = std::filesystem;
 
 namespace Cpp::Variant {
 
-VariantGenerator::VariantGenerator(std::shared_ptr<Config> config)
+VariantGenerator::VariantGenerator(std::shared_ptr<Config> config,
+                                   std::shared_ptr<Common::TypeRenderer> typeRenderer)
     : m_config(std::move(config))
-    , m_headerGenerator(m_config)
+    , m_taggedUnions(m_config)
+    , m_headerGenerator(m_config, std::move(typeRenderer))
 {
 }
 
@@ -21,6 +26,18 @@ std::vector<File> VariantGenerator::generate(PlantUml::SyntaxNode root)
     root.visit(translator);
     auto classes = std::move(translator).results();
 
+    // whether an alternative is trivially copyable depends on its members in the model
+    if (m_config->compactVariants()) {
+        Class::Translator classTranslator(m_config);
+        root.visit(classTranslator);
+        Enum::Translator enumTranslator(m_config);
+        root.visit(enumTranslator);
+
+        auto modelClasses = std::move(classTranslator).results();
+        auto modelEnums   = std::move(enumTranslator).results();
+        m_taggedUnions.select(classes, modelClasses, modelEnums);
+    }
+
     for (const auto& c : classes) {
         auto nsPath =
             std::accumulate(c.namespaces.begin(), c.namespaces.end(), fs::path(), [](const auto& a, const auto& b) {
@@ -0,0 +1,51 @@
+#include "ModelLoader.h"
+
+#include <array>
+#include <fstream>
+#include <iostream>
+
+#include "Common/StartupProfiler.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string readFullFile(const fs::path& filepath)
+{
+    std::string input;
+    std::ifstream file(filepath);
+    for (std::array<char, 256> buffer{}; file.getline(&buffer[0], 256);) {
+        input.append(buffer.data());
+        input.append("\n");
+    }
+
+    return input;
+}
+
+} // namespace
+
+const PlantUml::SyntaxNode* ModelLoader::load(const fs::path& modelFile)
+{
+    std::error_code ec;
+    auto lastWriteTime = fs::last_write_time(modelFile, ec);
+
+    auto& cached = m_cache[fs::absolute(modelFile).string()];
+    if (ec || cached.lastWriteTime != lastWriteTime) {
+        std::cout << "parsing file " << modelFile << std::endl;
+        auto input = readFullFile(modelFile);
+        StartupProfiler::mark("reading models");
+
+        // building the grammar is expensive, so only do it when there actually is something to parse
+        if (!m_parser) {
+            m_parser = std::make_unique<PlantUml::Parser>();
+            StartupProfiler::mark("grammar construction");
+        }
+
+        cached.lastWriteTime = lastWriteTime;
+        cached.parsed        = m_parser->parse(input);
+        cached.ast           = cached.parsed ? m_parser->getAST() : PlantUml::SyntaxNode{};
+        StartupProfiler::mark("parsing");
+    }
+
+    return cached.parsed ? &cached.ast : nullptr;
+}
@@ -1,29 +1,24 @@
 #include "PlantUML2Cpp.h"
+#include "ArchiveWriter.h"
+#include "Common/StartupProfiler.h"
 #include "Cpp/Class/ClassGenerator.h"
 #include "Cpp/Enum/EnumGenerator.h"
 #include "Cpp/Variant/VariantGenerator.h"
-#include "peg_parser/interpreter.h"
 
-#include <array>
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <numeric>
+#include <optional>
 #include <ranges>
 
-namespace fs = std::filesystem;
-
-std::string readFullFile(const fs::path& filepath)
-{
-    std::string input;
-    std::ifstream file(filepath);
-    for (std::array<char, 256> buffer{}; file.getline(&buffer[0], 256);) {
-        input.append(buffer.data());
-        input.append("\n");
-    }
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
 
-    return input;
-}
+namespace fs = std::filesystem;
 
 bool writeFile(const File& file)
 {
@@ -43,12 +38,63 @@ bool writeFile(const File& file)
     return false;
 }
 
-PlantUML2Cpp::PlantUML2Cpp(std::shared_ptr<Config> config)
+bool isUpToDate(const Config& config, const std::vector<fs::path>& models)
+{
+    std::ifstream manifest(config.manifestPath());
+    if (!manifest.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    // any change of the settings or templates changes what would be generated
+    if (!std::getline(manifest, line) || line != config.fingerprint()) {
+        return false;
+    }
+
+    // every model must be listed with its current modification time and every generated file must still exist
+    size_t modelCount = 0;
+    for (std::string type; manifest >> type;) {
+        if (type == "model") {
+            fs::file_time_type::rep time = 0;
+            manifest >> time;
+            manifest.ignore();
+            std::getline(manifest, line);
+
+            if (modelCount >= models.size() || models[modelCount] != line ||
+                fs::last_write_time(models[modelCount]).time_since_epoch().count() != time) {
+                return false;
+            }
+            ++modelCount;
+        } else if (type == "output") {
+            manifest.ignore();
+            std::getline(manifest, line);
+            if (!fs::exists(line)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    return modelCount == models.size();
+}
+
+void writeManifest(const Config& config, const std::vector<fs::path>& models, const std::vector<fs::path>& outputs)
+{
+    std::ofstream manifest(config.manifestPath(), std::ios_base::out | std::ios_base::trunc);
+    manifest << config.fingerprint() << "\n";
+    for (const auto& model : models) {
+        manifest << "model " << fs::last_write_time(model).time_since_epoch().count() << " " << model.string() << "\n";
+    }
+    for (const auto& output : outputs) {
+        manifest << "output " << output.string() << "\n";
+    }
+}
+
+PlantUML2Cpp::PlantUML2Cpp(std::shared_ptr<Config> config, std::shared_ptr<ModelLoader> loader)
     : m_config(std::move(config))
+    , m_loader(std::move(loader))
 {
-    m_generators.emplace_back(std::make_unique<Cpp::Class::ClassGenerator>(m_config));
-    m_generators.emplace_back(std::make_unique<Cpp::Variant::VariantGenerator>(m_config));
-    m_generators.emplace_back(std::make_unique<Cpp::Enum::EnumGenerator>(m_config));
 }
 
 bool PlantUML2Cpp::run()
@@ -61,26 +107,108 @@ bool PlantUML2Cpp::run()
         return false;
     }
 
-    fs::create_directory(m_config->headersPath());
-    fs::create_directory(m_config->sourcesPath());
-
+    std::vector<fs::path> models;
     for (const auto& file : fs::directory_iterator(modelPath)) {
         if (file.is_regular_file() && file.path().extension() == ".puml") {
-            std::cout << "parsing file " << file << std::endl;
-            std::string fileContents = readFullFile(file.path());
+            models.push_back(file.path());
+        }
+    }
+    std::ranges::sort(models);
+    StartupProfiler::mark("model discovery");
+
+    // existing files are never overwritten, so if no model changed since the last run there is nothing to do
+    bool writeToArchive = !m_config->archivePath().empty();
+    if (!writeToArchive && !m_config->overwriteExistingFiles() && isUpToDate(*m_config, models)) {
+        StartupProfiler::mark("up-to-date check");
+        std::cout << "all files are up to date" << std::endl;
+        return true;
+    }
+    StartupProfiler::mark("up-to-date check");
+
+    // in archive mode all files are streamed into one tar file (or stdout) instead of the include and source folders
+    std::ofstream archiveFile;
+    std::optional<std::ostream> archiveStream;
+    std::optional<ArchiveWriter> archive;
+    std::streambuf* coutBuffer = nullptr;
+    if (auto archivePath = m_config->archivePath(); !writeToArchive) {
+        fs::create_directory(m_config->headersPath());
+        fs::create_directory(m_config->sourcesPath());
+    } else if (archivePath == "-") {
+        // keep stdout clean for the archive and move all messages to stderr
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        archiveStream.emplace(std::cout.rdbuf());
+        coutBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+        archive.emplace(*archiveStream);
+    } else {
+        archiveFile.open(archivePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (!archiveFile.is_open()) {
+            std::cout << "unable to open archive " << archivePath << "! Abort" << std::endl;
+            return false;
+        }
+        archive.emplace(archiveFile);
+    }
 
-            PlantUml::Parser parser;
-            if (parser.parse(fileContents)) {
-                for (const auto& generator : m_generators) {
-                    auto files = generator->generate(parser.getAST());
+    bool allParsed = true;
+    std::vector<const PlantUml::SyntaxNode*> asts;
+    for (const auto& model : models) {
+        const auto* ast = m_loader->load(model);
+        if (ast == nullptr) {
+            allParsed = false;
+            continue;
+        }
+        asts.push_back(ast);
+    }
 
-                    for (const auto& f : files) {
-                        writeFile(f);
-                    }
+    // generators index the types of all models first, then every model is generated and written on its own
+    for (const auto& generator : generators()) {
+        generator->prepare(asts);
+    }
+    StartupProfiler::mark("indexing");
+
+    std::vector<fs::path> outputs;
+    for (const auto* ast : asts) {
+        for (const auto& generator : generators()) {
+            auto files = generator->generate(*ast);
+            StartupProfiler::mark("generation");
+
+            for (const auto& f : files) {
+                if (archive) {
+                    archive->add(f, m_config->projectPath());
+                } else if (!f.path.empty()) {
+                    writeFile(f);
+                    outputs.push_back(f.path);
                 }
             }
+            StartupProfiler::mark("writing");
         }
     }
 
-    return true;
+    bool success = true;
+    if (archive) {
+        success = archive->finish();
+    } else if (allParsed) {
+        writeManifest(*m_config, models, outputs);
+    }
+    if (coutBuffer != nullptr) {
+        std::cout.rdbuf(coutBuffer);
+    }
+
+    return success;
+}
+
+const std::vector<std::unique_ptr<Generator>>& PlantUML2Cpp::generators()
+{
+    // generators are only needed once there is a model to generate code from
+    if (m_generators.empty()) {
+        // all generators share the rendered spellings of types
+        auto typeRenderer = std::make_shared<Cpp::Common::TypeRenderer>();
+        m_generators.emplace_back(std::make_unique<Cpp::Class::ClassGenerator>(m_config, typeRenderer));
+        m_generators.emplace_back(std::make_unique<Cpp::Variant::VariantGenerator>(m_config, typeRenderer));
+        m_generators.emplace_back(std::make_unique<Cpp::Enum::EnumGenerator>(m_config));
+        StartupProfiler::mark("generator construction");
+    }
+
+    return m_generators;
 }
@@ -108,7 +108,10 @@ Parser::Parser(/* args */)
     // TODO
 
     // ========= ENUMERATOR =========
-    g["Enumerator"] << "Identifier" >> [](auto e) { return SyntaxNode{Enumerator{toName(e["Identifier"])}}; };
+    g["EnumeratorValue"] << "'-'? [0-9]+";
+    g["Enumerator"] << "Identifier ('=' EnumeratorValue)?" >> [](auto e) {
+        return SyntaxNode{Enumerator{toName(e["Identifier"]), toName(e["EnumeratorValue"])}};
+    };
 
     // ========= RELATIONSHIPS =========
     g["TriangleLeft"] << "'<|'";
@@ -339,6 +342,10 @@ Parser::Parser(/* args */)
 
 bool Parser::parse(std::string_view input)
 {
+    // the parser is reused for several files, so reset everything a previous run might have changed
+    newLinePositions.clear();
+    namespaceDelimiter = ".";
+
     try {
         newLinePositions.push_back(0);
         for (size_t i = 0; i < input.size(); ++i) {
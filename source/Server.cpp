@@ -0,0 +1,322 @@
+#include "Server.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+#ifndef _WIN32
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+
+fs::file_time_type lastWriteTime(const fs::path& path)
+{
+    std::error_code ec;
+    auto time = fs::last_write_time(path, ec);
+    return ec ? fs::file_time_type::min() : time;
+}
+
+#ifndef _WIN32
+
+// all messages are sequences of strings, each prefixed with its length
+bool writeAll(int fd, const char* data, size_t size)
+{
+    while (size > 0) {
+        auto written = ::write(fd, data, size);
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool readAll(int fd, char* data, size_t size)
+{
+    while (size > 0) {
+        auto received = ::read(fd, data, size);
+        if (received <= 0) {
+            return false;
+        }
+        data += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+}
+
+bool writeStrings(int fd, const std::vector<std::string>& strings)
+{
+    auto count = static_cast<std::uint32_t>(strings.size());
+    if (!writeAll(fd, reinterpret_cast<const char*>(&count), sizeof(count))) {
+        return false;
+    }
+    for (const auto& s : strings) {
+        auto size = static_cast<std::uint32_t>(s.size());
+        if (!writeAll(fd, reinterpret_cast<const char*>(&size), sizeof(size)) || !writeAll(fd, s.data(), s.size())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool readStrings(int fd, std::vector<std::string>& strings)
+{
+    std::uint32_t count = 0;
+    if (!readAll(fd, reinterpret_cast<char*>(&count), sizeof(count))) {
+        return false;
+    }
+    strings.resize(count);
+    for (auto& s : strings) {
+        std::uint32_t size = 0;
+        if (!readAll(fd, reinterpret_cast<char*>(&size), sizeof(size))) {
+            return false;
+        }
+        s.resize(size);
+        if (!readAll(fd, s.data(), size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int openSocket(const fs::path& socketPath, sockaddr_un& address)
+{
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    auto path = socketPath.string();
+    if (path.size() >= sizeof(address.sun_path)) {
+        std::cout << "socket path too long: " << socketPath << std::endl;
+        return -1;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+
+    return ::socket(AF_UNIX, SOCK_STREAM, 0);
+}
+
+#endif
+
+} // namespace
+
+Server::Server(fs::path socketPath)
+    : m_socketPath(std::move(socketPath))
+    , m_loader(std::make_shared<ModelLoader>())
+{
+}
+
+bool Server::run()
+{
+    if (!listen()) {
+        return false;
+    }
+
+    while (true) {
+        answer();
+    }
+}
+
+#ifdef _WIN32
+
+Server::~Server() = default;
+
+bool Server::listen()
+{
+    std::cout << "server mode is not supported on this platform" << std::endl;
+    return false;
+}
+
+void Server::answer() {}
+
+int Server::forward(const fs::path& /*socketPath*/, int /*argc*/, char** /*argv*/)
+{
+    std::cout << "client mode is not supported on this platform" << std::endl;
+    return -1;
+}
+
+#else
+
+Server::~Server()
+{
+    if (m_listener >= 0) {
+        ::close(m_listener);
+        ::unlink(m_socketPath.c_str());
+    }
+}
+
+bool Server::listen()
+{
+    sockaddr_un address{};
+    int listener = openSocket(m_socketPath, address);
+    if (listener < 0) {
+        return false;
+    }
+
+    // a client that disconnects early must not take the server down with it
+    std::signal(SIGPIPE, SIG_IGN);
+
+    // remove a stale socket of a previous server, but never a file that happens to be at the path
+    struct stat status{};
+    bool exists = ::lstat(address.sun_path, &status) == 0;
+    if (exists && !S_ISSOCK(status.st_mode)) {
+        std::cout << m_socketPath << " exists and is not a socket" << std::endl;
+        ::close(listener);
+        return false;
+    }
+    if (exists && ::unlink(address.sun_path) != 0) {
+        std::cout << "unable to remove the stale socket " << m_socketPath << std::endl;
+        ::close(listener);
+        return false;
+    }
+
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, 8) != 0) {
+        std::cout << "unable to listen on " << m_socketPath << std::endl;
+        ::close(listener);
+        return false;
+    }
+
+    std::cout << "listening on " << m_socketPath << std::endl;
+    m_listener = listener;
+    return true;
+}
+
+void Server::answer()
+{
+    int client = ::accept(m_listener, nullptr, nullptr);
+    if (client < 0) {
+        return;
+    }
+
+    std::vector<std::string> request;
+    if (readStrings(client, request)) {
+        std::string out;
+        std::string err;
+        int exitCode = handle(request, out, err);
+        writeStrings(client, {std::to_string(exitCode), out, err});
+    }
+    ::close(client);
+}
+
+int Server::forward(const fs::path& socketPath, int argc, char** argv)
+{
+    // the request consists of the working directory and the command line without the client option
+    std::vector<std::string> request{fs::current_path().string()};
+    for (int i = 0; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--client") {
+            ++i;
+        } else if (!arg.starts_with("--client=")) {
+            request.emplace_back(arg);
+        }
+    }
+
+    sockaddr_un address{};
+    int fd = openSocket(socketPath, address);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        std::cout << "unable to connect to server at " << socketPath << std::endl;
+        ::close(fd);
+        return -1;
+    }
+
+    std::vector<std::string> response;
+    bool success = writeStrings(fd, request) && readStrings(fd, response) && response.size() == 3;
+    ::close(fd);
+
+    if (!success) {
+        std::cout << "lost connection to server at " << socketPath << std::endl;
+        return -1;
+    }
+
+    std::cout << response[1] << std::flush;
+    std::cerr << response[2] << std::flush;
+
+    try {
+        return std::stoi(response[0]);
+    } catch (const std::exception&) {
+        std::cout << "invalid exit code " << response[0] << " from server at " << socketPath << std::endl;
+        return -1;
+    }
+}
+
+#endif
+
+int Server::handle(const std::vector<std::string>& request, std::string& out, std::string& err)
+{
+    if (request.size() < 2) {
+        err = "invalid request\n";
+        return -1;
+    }
+
+    // capture everything the request prints so it can be sent back to the client
+    std::ostringstream outStream;
+    std::ostringstream errStream;
+    auto* coutBuffer = std::cout.rdbuf(outStream.rdbuf());
+    auto* cerrBuffer = std::cerr.rdbuf(errStream.rdbuf());
+
+    int exitCode = -2;
+    try {
+        exitCode = generate(request);
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+    }
+
+    std::cout.rdbuf(coutBuffer);
+    std::cerr.rdbuf(cerrBuffer);
+
+    out = outStream.str();
+    err = errStream.str();
+    return exitCode;
+}
+
+int Server::generate(const std::vector<std::string>& request)
+{
+    std::string key;
+    for (const auto& s : request) {
+        key += s;
+        key += '\0';
+    }
+
+    // configs and generators are reused as long as the same command line is sent and the config file didn't change
+    auto it = m_projects.find(key);
+    if (it != m_projects.end() && it->second.configWriteTime != lastWriteTime(it->second.config->configPath())) {
+        m_projects.erase(it);
+        it = m_projects.end();
+    }
+
+    if (it == m_projects.end()) {
+        std::vector<std::string> args(request.begin() + 1, request.end());
+        std::vector<char*> argv;
+        for (auto& arg : args) {
+            argv.push_back(arg.data());
+        }
+        argv.push_back(nullptr);
+
+        // relative paths on the command line are relative to the working directory of the client, the working
+        // directory of the server is shared by all requests and never changed
+        auto config = std::make_shared<Config>();
+        if (!config->parseAndLoad(static_cast<int>(args.size()), argv.data(), request.front())) {
+            return -1;
+        }
+
+        Project project;
+        project.configWriteTime = lastWriteTime(config->configPath());
+        project.generator       = std::make_unique<PlantUML2Cpp>(config, m_loader);
+        project.config          = std::move(config);
+        it                      = m_projects.emplace(key, std::move(project)).first;
+    }
+
+    return it->second.generator->run() ? 0 : -2;
+}
@@ -1,13 +1,34 @@
+#include "Common/StartupProfiler.h"
 #include "Config.h"
 #include "PlantUML2Cpp.h"
+#include "Server.h"
+
+#include <iostream>
 
 int main(int argc, char** argv)
 {
+    StartupProfiler::mark("process start");
+
     auto config = std::make_shared<Config>();
     if (!config->parseAndLoad(argc, argv)) {
         return -1;
     }
 
+    if (!config->clientSocket().empty()) {
+        return Server::forward(config->clientSocket(), argc, argv);
+    }
+
+    if (!config->serverSocket().empty()) {
+        Server server(config->serverSocket());
+        return server.run() ? 0 : -2;
+    }
+
     PlantUML2Cpp puml2cpp(config);
-    return puml2cpp.run() ? 0 : -2;
+    bool success = puml2cpp.run();
+
+    if (config->profileStartup()) {
+        StartupProfiler::report(std::cerr);
+    }
+
+    return success ? 0 : -2;
 }
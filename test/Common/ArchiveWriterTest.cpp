@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+
+#include <numeric>
+#include <sstream>
+#include <string>
+using namespace std::string_literals;
+
+#include "ArchiveWriter.h"
+
+namespace {
+
+size_t headerChecksum(std::string header)
+{
+    std::fill_n(header.begin() + 148, 8, ' ');
+    return std::accumulate(header.begin(), header.end(), size_t(0), [](size_t acc, char c) {
+        return acc + static_cast<unsigned char>(c);
+    });
+}
+
+} // namespace
+
+TEST(ArchiveWriterTest, singleFile)
+{
+    // Arrange
+    std::ostringstream out;
+    ArchiveWriter sut(out);
+
+    // Act
+    bool added    = sut.add("include/ns/Test.h", "#pragma once\n");
+    bool finished = sut.finish();
+
+    // Assert
+    EXPECT_TRUE(added);
+    EXPECT_TRUE(finished);
+
+    auto archive = out.str();
+    ASSERT_EQ(archive.size(), 4 * 512);
+
+    auto header = archive.substr(0, 512);
+    EXPECT_EQ(header.substr(0, 17), "include/ns/Test.h");
+    EXPECT_EQ(header[17], '\0');
+    EXPECT_EQ(header.substr(124, 12), "00000000015\0"s);
+    EXPECT_EQ(header[156], '0');
+    EXPECT_EQ(header.substr(257, 5), "ustar");
+    EXPECT_EQ(std::stoul(header.substr(148, 6), nullptr, 8), headerChecksum(header));
+
+    EXPECT_EQ(archive.substr(512, 13), "#pragma once\n");
+    EXPECT_EQ(archive.find_first_not_of('\0', 512 + 13), std::string::npos);
+}
+
+TEST(ArchiveWriterTest, fileRelativeToProject)
+{
+    // Arrange
+    std::ostringstream out;
+    ArchiveWriter sut(out);
+
+    File file{"project/source/Test.cpp", "content"};
+
+    // Act
+    sut.add(file, "project");
+    sut.finish();
+
+    // Assert
+    EXPECT_EQ(out.str().substr(0, 16), "source/Test.cpp"s + '\0');
+}
+
+TEST(ArchiveWriterTest, longPathUsesPrefix)
+{
+    // Arrange
+    std::ostringstream out;
+    ArchiveWriter sut(out);
+
+    std::string directory = "include/" + std::string(80, 'a');
+    std::string name      = std::string(60, 'b') + ".h";
+
+    // Act
+    bool added = sut.add(directory + "/" + name, "");
+    sut.finish();
+
+    // Assert
+    EXPECT_TRUE(added);
+
+    auto header = out.str().substr(0, 512);
+    EXPECT_EQ(header.substr(0, name.size() + 1), name + '\0');
+    EXPECT_EQ(header.substr(345, directory.size() + 1), directory + '\0');
+}
+
+TEST(ArchiveWriterTest, nothingAddedAfterFinish)
+{
+    // Arrange
+    std::ostringstream out;
+    ArchiveWriter sut(out);
+
+    // Act
+    sut.finish();
+    bool added = sut.add("include/Test.h", "content");
+
+    // Assert
+    EXPECT_FALSE(added);
+    EXPECT_EQ(out.str().size(), 2 * 512);
+}
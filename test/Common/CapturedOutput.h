@@ -0,0 +1,21 @@
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// everything printed to std::cout while it lives
+class CapturedOutput
+{
+public:
+    CapturedOutput()
+        : m_buffer(std::cout.rdbuf(m_out.rdbuf()))
+    {}
+    ~CapturedOutput() { std::cout.rdbuf(m_buffer); }
+
+    std::string str() const { return m_out.str(); }
+
+private:
+    std::ostringstream m_out;
+    std::streambuf* m_buffer;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Config.h"
+
+// a config as if PlantUML2Cpp was called with the given command line arguments
+inline std::shared_ptr<Config> configWithArguments(std::vector<std::string> arguments)
+{
+    auto config = std::make_shared<Config>();
+
+    arguments.insert(arguments.begin(), "test");
+    std::vector<char*> argv;
+    for (auto& arg : arguments)
+        argv.push_back(arg.data());
+    argv.push_back(nullptr);
+
+    config->parseAndLoad(static_cast<int>(argv.size()) - 1, argv.data());
+    return config;
+}
@@ -8,6 +8,7 @@ using namespace std::string_literals;
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
+#include "Common/ConfigHelper.h"
 #include "Config.h"
 
 TEST(ConfigTest, parseBasicArgs)
@@ -87,10 +88,14 @@ TEST(ConfigTest, configFileReading)
     EXPECT_EQ(sut.sourceFileExtention(), "cp");
     EXPECT_EQ(sut.memberPrefix(), "pre");
     EXPECT_EQ(sut.indent(), "t");
+    EXPECT_EQ(sut.classHeaderTemplate(), testDir / "Common" / "class.tpl");
+    EXPECT_TRUE(sut.enumHeaderTemplate().empty());
     EXPECT_EQ(sut.containerByCardinalityComposition().size(), 1);
     EXPECT_EQ(sut.containerByCardinalityComposition().at("test"), "test");
     EXPECT_EQ(sut.containerByCardinalityAggregation().size(), 1);
     EXPECT_EQ(sut.containerByCardinalityAggregation().at("test"), "test");
+    EXPECT_EQ(sut.aggregationPolicy(), "pool");
+    EXPECT_EQ(sut.aggregationPolicyByStereotype().at("test"), "test");
     EXPECT_EQ(sut.typeToIncludeMap().size(), 1);
     EXPECT_EQ(sut.typeToIncludeMap().at("test"), "test");
     EXPECT_EQ(sut.umlToCppTypeMap().size(), 1);
@@ -155,4 +160,19 @@ TEST(ConfigTest, configFileWriting)
 
     std::filesystem::remove(testDir / "tmp" / "config.json");
     std::filesystem::remove(testDir / "tmp");
-}
\ No newline at end of file
+}
+
+TEST(ConfigTest, fingerprint)
+{
+    // Arrange
+    auto defaults = configWithArguments({});
+    auto same     = configWithArguments({});
+    auto flag     = configWithArguments({"--finalClasses"});
+    auto prefix   = configWithArguments({"-p", "x_"});
+
+    // Act & Assert
+    EXPECT_EQ(defaults->fingerprint(), same->fingerprint());
+    EXPECT_NE(defaults->fingerprint(), flag->fingerprint());
+    EXPECT_NE(defaults->fingerprint(), prefix->fingerprint());
+    EXPECT_NE(flag->fingerprint(), prefix->fingerprint());
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "Common/CapturedOutput.h"
+#include "ModelLoader.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+fs::path writeModel(const std::string& name, const std::string& content)
+{
+    auto path = fs::temp_directory_path() / name;
+    std::ofstream(path) << content;
+    return path;
+}
+
+} // namespace
+
+TEST(ModelLoaderTest, cachedUntilModified)
+{
+    // Arrange
+    auto model = writeModel("PlantUML2CppModelLoaderTest.puml", "@startuml\nclass Test\n@enduml\n");
+    ModelLoader sut;
+
+    // Act
+    const PlantUml::SyntaxNode* first  = nullptr;
+    const PlantUml::SyntaxNode* second = nullptr;
+    std::string firstOutput;
+    std::string secondOutput;
+    {
+        CapturedOutput out;
+        first       = sut.load(model);
+        firstOutput = out.str();
+    }
+    {
+        CapturedOutput out;
+        second       = sut.load(model);
+        secondOutput = out.str();
+    }
+
+    std::ofstream(model) << "@startuml\nclass Test\nclass Other\n@enduml\n";
+    fs::last_write_time(model, fs::last_write_time(model) + std::chrono::seconds(2));
+    const PlantUml::SyntaxNode* modified = nullptr;
+    std::string modifiedOutput;
+    {
+        CapturedOutput out;
+        modified       = sut.load(model);
+        modifiedOutput = out.str();
+    }
+    fs::remove(model);
+
+    // Assert
+    ASSERT_NE(first, nullptr);
+    EXPECT_NE(firstOutput.find("parsing file"), std::string::npos);
+    EXPECT_EQ(second, first);
+    EXPECT_TRUE(secondOutput.empty());
+    ASSERT_NE(modified, nullptr);
+    EXPECT_NE(modifiedOutput.find("parsing file"), std::string::npos);
+}
+
+TEST(ModelLoaderTest, unparsableModel)
+{
+    // Arrange
+    auto model = writeModel("PlantUML2CppModelLoaderTestInvalid.puml", "this is no model\n");
+    ModelLoader sut;
+
+    // Act
+    const PlantUml::SyntaxNode* result = nullptr;
+    {
+        CapturedOutput out;
+        result = sut.load(model);
+    }
+    fs::remove(model);
+
+    // Assert
+    EXPECT_EQ(result, nullptr);
+}
@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Common/CapturedOutput.h"
+#include "Common/ConfigHelper.h"
+#include "PlantUML2Cpp.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// a project folder with one model in the default layout
+fs::path createProject(const std::string& name)
+{
+    auto project = fs::temp_directory_path() / name;
+    fs::remove_all(project);
+    fs::create_directories(project / "models");
+    std::ofstream(project / "models" / "Test.puml") << "@startuml\nclass Test\n@enduml\n";
+    return project;
+}
+
+// the output of a run with the given arguments on the project
+std::string run(const fs::path& project, std::vector<std::string> arguments = {})
+{
+    arguments.push_back(project.string());
+    PlantUML2Cpp sut(configWithArguments(arguments));
+
+    CapturedOutput out;
+    EXPECT_TRUE(sut.run());
+    return out.str();
+}
+
+bool upToDate(const std::string& output)
+{
+    return output.find("all files are up to date") != std::string::npos;
+}
+
+} // namespace
+
+TEST(PlantUML2CppTest, upToDateWithoutChanges)
+{
+    // Arrange
+    auto project = createProject("PlantUML2CppUpToDate");
+
+    // Act
+    auto first  = run(project);
+    auto second = run(project);
+
+    // Assert
+    EXPECT_FALSE(upToDate(first)) << first;
+    EXPECT_TRUE(fs::exists(project / "include" / "Test.h"));
+    EXPECT_TRUE(upToDate(second)) << second;
+    fs::remove_all(project);
+}
+
+TEST(PlantUML2CppTest, notUpToDateAfterModelChange)
+{
+    // Arrange
+    auto project = createProject("PlantUML2CppModelChange");
+    auto model   = project / "models" / "Test.puml";
+
+    // Act
+    run(project);
+    std::ofstream(model) << "@startuml\nclass Test\nclass Other\n@enduml\n";
+    fs::last_write_time(model, fs::last_write_time(model) + std::chrono::seconds(2));
+    auto output = run(project);
+
+    // Assert
+    EXPECT_FALSE(upToDate(output)) << output;
+    EXPECT_TRUE(fs::exists(project / "include" / "Other.h"));
+    fs::remove_all(project);
+}
+
+TEST(PlantUML2CppTest, notUpToDateAfterFlagChange)
+{
+    // Arrange
+    auto project = createProject("PlantUML2CppFlagChange");
+
+    // Act
+    run(project);
+    auto output = run(project, {"--specialMembers"});
+    auto again  = run(project, {"--specialMembers"});
+
+    // Assert
+    EXPECT_FALSE(upToDate(output)) << output;
+    EXPECT_TRUE(upToDate(again)) << again;
+    fs::remove_all(project);
+}
+
+TEST(PlantUML2CppTest, notUpToDateAfterConfigFileChange)
+{
+    // Arrange
+    auto project = createProject("PlantUML2CppConfigChange");
+
+    // Act
+    run(project);
+    std::ofstream(project / "models" / "config.json") << R"({"typeToIncludeMap": {"std::string": "my_string.h"}})";
+    auto output = run(project);
+
+    // Assert
+    EXPECT_FALSE(upToDate(output)) << output;
+    fs::remove_all(project);
+}
+
+TEST(PlantUML2CppTest, notUpToDateAfterTemplateChange)
+{
+    // Arrange
+    auto project = createProject("PlantUML2CppTemplateChange");
+    auto layout  = project / "models" / "class.template";
+    std::ofstream(layout) << "#pragma once\n\n{{includes}}\n{{definition}}\n{\n{{body}}};\n";
+
+    // Act
+    run(project, {"--classHeaderTemplate", "class.template"});
+    auto unchanged = run(project, {"--classHeaderTemplate", "class.template"});
+    std::ofstream(layout) << "#pragma once\n\n// generated\n{{includes}}\n{{definition}}\n{\n{{body}}};\n";
+    auto changed = run(project, {"--classHeaderTemplate", "class.template"});
+
+    // Assert
+    EXPECT_TRUE(upToDate(unchanged)) << unchanged;
+    EXPECT_FALSE(upToDate(changed)) << changed;
+    fs::remove_all(project);
+}
@@ -0,0 +1,221 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "Common/CapturedOutput.h"
+#include "Server.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// a project folder with one model in the default layout
+fs::path createProject(const std::string& name)
+{
+    auto project = fs::temp_directory_path() / name;
+    fs::remove_all(project);
+    fs::create_directories(project / "models");
+    std::ofstream(project / "models" / "Test.puml") << "@startuml\nclass Test\n@enduml\n";
+    return project;
+}
+
+} // namespace
+
+TEST(ServerTest, requestRunsInWorkingDirectoryOfClient)
+{
+    // Arrange
+    auto project = createProject("PlantUML2CppServerTestProject");
+    auto archive = project / "out.tar";
+    auto cwd     = fs::current_path();
+    Server sut(fs::temp_directory_path() / "PlantUML2CppServerTest.socket");
+
+    // Act
+    std::string out;
+    std::string err;
+    int exitCode        = sut.handle({project.string(), "PlantUML2Cpp"}, out, err);
+    int archiveExitCode = sut.handle({project.string(), "PlantUML2Cpp", "-a", "out.tar"}, out, err);
+
+    // Assert
+    EXPECT_EQ(exitCode, 0) << out << err;
+    EXPECT_EQ(archiveExitCode, 0) << out << err;
+    EXPECT_TRUE(fs::exists(project / "include" / "Test.h")) << out;
+    EXPECT_TRUE(fs::exists(archive)) << out;
+    EXPECT_EQ(fs::current_path(), cwd);
+    fs::remove_all(project);
+}
+
+TEST(ServerTest, invalidRequest)
+{
+    // Arrange
+    Server sut(fs::temp_directory_path() / "PlantUML2CppServerTest.socket");
+
+    // Act
+    std::string out;
+    std::string err;
+    int exitCode = sut.handle({"/"}, out, err);
+
+    // Assert
+    EXPECT_NE(exitCode, 0);
+    EXPECT_EQ(err, "invalid request\n");
+}
+
+#ifndef _WIN32
+
+TEST(ServerTest, clientGetsExitCodeAndOutput)
+{
+    // Arrange
+    auto project = createProject("PlantUML2CppServerTestClient");
+    auto socket  = fs::temp_directory_path() / "PlantUML2CppServerTestClient.socket";
+    Server server(socket);
+    bool listening = false;
+    {
+        CapturedOutput out;
+        listening = server.listen();
+    }
+    ASSERT_TRUE(listening);
+
+    auto cwd = fs::current_path();
+    fs::current_path(project);
+    std::vector<std::string> arguments{"PlantUML2Cpp", "--client", socket.string(), "-f"};
+    std::vector<char*> argv;
+    for (auto& arg : arguments) {
+        argv.push_back(arg.data());
+    }
+
+    // Act
+    int exitCode = -1;
+    std::string output;
+    {
+        CapturedOutput out;
+        std::thread answering([&server]() { server.answer(); });
+        exitCode = Server::forward(socket, static_cast<int>(argv.size()), argv.data());
+        answering.join();
+        output = out.str();
+    }
+    fs::current_path(cwd);
+
+    // Assert
+    EXPECT_EQ(exitCode, 0) << output;
+    EXPECT_NE(output.find("writing to file"), std::string::npos) << output;
+    EXPECT_TRUE(fs::exists(project / "include" / "Test.h"));
+    fs::remove_all(project);
+}
+
+TEST(ServerTest, clientRejectsMalformedResponse)
+{
+    // Arrange
+    auto socket = fs::temp_directory_path() / "PlantUML2CppServerTestMalformed.socket";
+    fs::remove(socket);
+
+    // a server that answers every request with an exit code that isn't a number
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    socket.string().copy(address.sun_path, sizeof(address.sun_path) - 1);
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+    ASSERT_EQ(::listen(listener, 1), 0);
+
+    std::thread server([listener]() {
+        std::string response;
+        auto append = [&response](std::uint32_t value) {
+            response.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        append(3);
+        for (std::string_view s : {"no number", "", ""}) {
+            append(static_cast<std::uint32_t>(s.size()));
+            response += s;
+        }
+
+        // the request is read until the client hangs up, so closing doesn't discard unread data
+        int client = ::accept(listener, nullptr, nullptr);
+        [[maybe_unused]] auto written = ::write(client, response.data(), response.size());
+        char buffer[256];
+        while (::read(client, buffer, sizeof(buffer)) > 0) {
+        }
+        ::close(client);
+    });
+
+    std::string arg = "PlantUML2Cpp";
+    char* argv[]    = {arg.data()};
+
+    // Act
+    int exitCode = 0;
+    std::string output;
+    {
+        CapturedOutput out;
+        exitCode = Server::forward(socket, 1, argv);
+        output   = out.str();
+    }
+    server.join();
+    ::close(listener);
+    fs::remove(socket);
+
+    // Assert
+    EXPECT_EQ(exitCode, -1);
+    EXPECT_NE(output.find("invalid exit code no number"), std::string::npos) << output;
+}
+
+TEST(ServerTest, staleSocketIsReplaced)
+{
+    // Arrange
+    auto socket = fs::temp_directory_path() / "PlantUML2CppServerTestStale.socket";
+    fs::remove(socket);
+
+    // a socket that is bound but never removed, like one of a server that crashed
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    socket.string().copy(address.sun_path, sizeof(address.sun_path) - 1);
+    int stale = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(::bind(stale, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+    ::close(stale);
+
+    Server sut(socket);
+
+    // Act
+    bool listening = false;
+    {
+        CapturedOutput out;
+        listening = sut.listen();
+    }
+
+    // Assert
+    EXPECT_TRUE(listening);
+}
+
+TEST(ServerTest, otherFilesAreNotReplaced)
+{
+    // Arrange
+    auto path = fs::temp_directory_path() / "PlantUML2CppServerTestFile.socket";
+    std::ofstream(path) << "not a socket";
+
+    Server sut(path);
+
+    // Act
+    bool listening = true;
+    std::string output;
+    {
+        CapturedOutput out;
+        listening = sut.listen();
+        output    = out.str();
+    }
+
+    // Assert
+    EXPECT_FALSE(listening);
+    EXPECT_NE(output.find("is not a socket"), std::string::npos) << output;
+    EXPECT_TRUE(fs::is_regular_file(path));
+    fs::remove(path);
+}
+
+#endif
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "Common/ConfigHelper.h"
+#include "Config.h"
+#include "Cpp/Class/ClassGenerator.h"
+#include "PlantUml/SyntaxNode.h"
+
+namespace puml = PlantUml;
+
+namespace Cpp::Class {
+
+namespace {
+
+puml::SyntaxNode element(const std::string& name, puml::ElementType type = puml::ElementType::Class)
+{
+    puml::SyntaxNode node{puml::Element{{name}, "", ' ', {}, {}, type}};
+    node.children.push_back(puml::SyntaxNode{puml::Variable{
+        "value", puml::Type{{"int"}, {}}, {}, puml::Visibility::Private, false, false}});
+    node.children.push_back(puml::SyntaxNode{puml::Method{
+        "name", puml::Type{{"std", "string"}, {}}, {}, puml::Visibility::Public, false, true, false}});
+    node.children.push_back(puml::SyntaxNode{puml::End{puml::EndType::Element}});
+    return node;
+}
+
+puml::SyntaxNode extension(const std::string& subject, const std::string& object)
+{
+    return puml::SyntaxNode{
+        puml::Relationship{{subject}, {object}, "", "", "", false, puml::RelationshipType::Extension}};
+}
+
+// enough classes in nested and global namespaces that several threads render them
+puml::SyntaxNode largeDiagram()
+{
+    puml::SyntaxNode root{puml::Container{{}, "", puml::ContainerType::Document}};
+    puml::SyntaxNode outer{puml::Container{{"outer"}, "", puml::ContainerType::Namespace}};
+    puml::SyntaxNode inner{puml::Container{{"inner"}, "", puml::ContainerType::Namespace}};
+
+    for (int i = 0; i < 60; ++i) {
+        root.children.push_back(element("Global" + std::to_string(i)));
+        outer.children.push_back(element("Outer" + std::to_string(i), puml::ElementType::Abstract));
+        inner.children.push_back(element("Inner" + std::to_string(i)));
+        if (i > 0) {
+            inner.children.push_back(extension("Inner" + std::to_string(i), "Inner" + std::to_string(i - 1)));
+        }
+    }
+
+    inner.children.push_back(puml::SyntaxNode{puml::End{puml::EndType::Namespace}});
+    outer.children.push_back(std::move(inner));
+    outer.children.push_back(puml::SyntaxNode{puml::End{puml::EndType::Namespace}});
+    root.children.push_back(std::move(outer));
+    root.children.push_back(puml::SyntaxNode{puml::End{puml::EndType::Document}});
+    return root;
+}
+
+puml::SyntaxNode diagram(std::vector<puml::SyntaxNode> children)
+{
+    puml::SyntaxNode root{puml::Container{{}, "", puml::ContainerType::Document}};
+    root.children = std::move(children);
+    root.children.push_back(puml::SyntaxNode{puml::End{puml::EndType::Document}});
+    return root;
+}
+
+} // namespace
+
+TEST(ClassGeneratorTest, ClassesOfOtherModels)
+{
+    // Arrange
+    ClassGenerator sut(configWithArguments({"--finalClasses"}));
+    auto interfaces = diagram({element("Base", puml::ElementType::Interface)});
+    auto classes    = diagram({element("Derived"), extension("Derived", "Base")});
+
+    // Act
+    sut.prepare({&interfaces, &classes});
+    auto interfaceFiles = sut.generate(interfaces);
+    auto classFiles     = sut.generate(classes);
+
+    // Assert
+    ASSERT_EQ(interfaceFiles.size(), 2);
+    ASSERT_EQ(classFiles.size(), 2);
+    EXPECT_EQ(interfaceFiles[0].path.filename(), "Base.h");
+    EXPECT_EQ(interfaceFiles[0].content.find("final"), std::string::npos) << interfaceFiles[0].content;
+    EXPECT_EQ(classFiles[0].path.filename(), "Derived.h");
+    EXPECT_NE(classFiles[0].content.find("class Derived final"), std::string::npos) << classFiles[0].content;
+    EXPECT_NE(classFiles[0].content.find("std::string name() final;"), std::string::npos) << classFiles[0].content;
+}
+
+TEST(ClassGeneratorTest, ParallelRenderingMatchesSequential)
+{
+    // Arrange
+    auto config = std::make_shared<Config>();
+    ClassGenerator sequential(config, std::make_shared<Common::TypeRenderer>(), 1);
+    ClassGenerator parallel(config, std::make_shared<Common::TypeRenderer>(), 4);
+
+    // Act
+    auto expected = sequential.generate(largeDiagram());
+    auto output   = parallel.generate(largeDiagram());
+
+    // Assert
+    ASSERT_EQ(expected.size(), 2 * 180);
+    ASSERT_EQ(output.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(output[i].path, expected[i].path) << i;
+        EXPECT_EQ(output[i].content, expected[i].content) << expected[i].path;
+    }
+    EXPECT_EQ(output.front().path.filename(), "Global0.h");
+    EXPECT_EQ(output.back().path.filename(), "Inner59.cpp");
+}
+
+} // namespace Cpp::Class
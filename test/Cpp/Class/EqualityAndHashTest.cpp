@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Class/EqualityAndHash.h"
+
+namespace Cpp::Class {
+
+TEST(EqualityAndHashTest, DisabledByDefault)
+{
+    // Arrange
+    EqualityAndHash sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    auto& input    = classes[0];
+    input.name     = "Point";
+    input.isStruct = true;
+    input.body.emplace_back(Variable{"x", Common::Type{"int"}});
+
+    // Act
+    sut.add(classes, {});
+
+    // Assert
+    EXPECT_FALSE(input.isHashable);
+    EXPECT_EQ(input.body.size(), 1);
+}
+
+TEST(EqualityAndHashTest, PublicStruct)
+{
+    // Arrange
+    EqualityAndHash sut{configWithArguments({"--equalityAndHash"})};
+
+    std::vector<Class> classes(1);
+    auto& input    = classes[0];
+    input.name     = "Point";
+    input.isStruct = true;
+    input.body.emplace_back(Variable{"x", Common::Type{"int"}});
+
+    // Act
+    sut.add(classes, {});
+
+    // Assert
+    EXPECT_TRUE(input.isHashable);
+    EXPECT_TRUE(input.localIncludes.contains("PlantUML2Cpp/Hash.h"));
+    const auto& body = input.body;
+    ASSERT_EQ(body.size(), 3);
+    EXPECT_EQ(std::get<std::string>(body[1]), "");
+    EXPECT_EQ(std::get<std::string>(body[2]), "    bool operator==(const Point&) const = default;");
+}
+
+TEST(EqualityAndHashTest, FriendHashForPrivateMembers)
+{
+    // Arrange
+    EqualityAndHash sut{configWithArguments({"--equalityAndHash"})};
+
+    std::vector<Class> classes(1);
+    auto& input    = classes[0];
+    input.name     = "Key";
+    input.isStruct = true;
+    input.body.emplace_back(VisibilityKeyword{"private:"});
+    input.body.emplace_back(Variable{"id", Common::Type{"std::string"}});
+
+    // Act
+    sut.add(classes, {});
+
+    // Assert
+    const auto& body = input.body;
+    ASSERT_EQ(body.size(), 6);
+    EXPECT_EQ(std::get<VisibilityKeyword>(body[3]).name, "public:");
+    EXPECT_EQ(std::get<std::string>(body[4]), "    bool operator==(const Key&) const = default;");
+    EXPECT_EQ(std::get<std::string>(body[5]), "    friend struct std::hash<Key>;");
+}
+
+TEST(EqualityAndHashTest, NoValueTypes)
+{
+    // Arrange
+    EqualityAndHash sut{configWithArguments({"--equalityAndHash"})};
+
+    std::vector<Class> classes(4);
+    classes[0].name     = "Class";
+    classes[1].name     = "Derived";
+    classes[1].isStruct = true;
+    classes[1].inherits = {"Base"};
+    classes[2].name     = "Abstract";
+    classes[2].isStruct = true;
+    classes[2].body.emplace_back(Method{"draw", Common::Type{"void"}, "", true});
+    classes[3].name     = "Referring";
+    classes[3].isStruct = true;
+    classes[3].body.emplace_back(Variable{"target", Common::Type{"Point&"}});
+
+    // Act
+    sut.add(classes, {});
+
+    // Assert
+    for (const auto& c : classes) {
+        EXPECT_FALSE(c.isHashable) << c.name;
+    }
+}
+
+TEST(EqualityAndHashTest, MembersWithoutHash)
+{
+    // Arrange
+    EqualityAndHash sut{configWithArguments({"--equalityAndHash"})};
+
+    std::vector<Class> classes(4);
+    classes[0].name = "Connection";
+    classes[0].body.emplace_back(Variable{"socket", Common::Type{"int"}});
+    classes[1].name     = "Route";
+    classes[1].isStruct = true;
+    classes[1].body.emplace_back(Variable{"connection", Common::Type{"Connection"}});
+    classes[2].name     = "Routes";
+    classes[2].isStruct = true;
+    classes[2].body.emplace_back(Variable{"routes", Common::Type{"std::vector", {Common::Type{"Route"}}}});
+    classes[3].name     = "Foreign";
+    classes[3].isStruct = true;
+    classes[3].body.emplace_back(Variable{"value", Common::Type{"QString"}});
+
+    // Act
+    sut.add(classes, {});
+
+    // Assert
+    for (const auto& c : classes) {
+        EXPECT_FALSE(c.isHashable) << c.name;
+        EXPECT_TRUE(c.localIncludes.empty()) << c.name;
+    }
+    EXPECT_EQ(std::get<std::string>(classes[1].body.back()), "    bool operator==(const Route&) const = default;");
+}
+
+TEST(EqualityAndHashTest, MembersWithHash)
+{
+    // Arrange
+    EqualityAndHash sut{configWithArguments({"--equalityAndHash"})};
+
+    std::vector<Enum::Enum> enums(1);
+    enums[0].name       = "Kind";
+    enums[0].namespaces = {"geo"};
+
+    std::vector<Class> project(1);
+    project[0].name       = "Point";
+    project[0].namespaces = {"geo"};
+    project[0].isStruct   = true;
+    project[0].body.emplace_back(Variable{"kind", Common::Type{"Kind"}});
+    project[0].body.emplace_back(Variable{"next", Common::Type{"Point*"}});
+    sut.index(project, enums);
+
+    std::vector<Class> classes(2);
+    classes[0].name       = "Path";
+    classes[0].namespaces = {"geo", "route"};
+    classes[0].isStruct   = true;
+    classes[0].body.emplace_back(Variable{"points", Common::Type{"std::vector", {Common::Type{"Point"}}}});
+    classes[0].body.emplace_back(Variable{"label", Common::Type{"std::optional", {Common::Type{"Label"}}}});
+    classes[1].name       = "Label";
+    classes[1].namespaces = {"geo", "route"};
+    classes[1].isStruct   = true;
+    classes[1].body.emplace_back(Variable{"text", Common::Type{"std::string"}});
+
+    // Act
+    sut.add(classes, {});
+
+    // Assert
+    EXPECT_TRUE(classes[0].isHashable);
+    EXPECT_TRUE(classes[1].isHashable);
+}
+
+} // namespace Cpp::Class
@@ -0,0 +1,135 @@
+#include "gtest/gtest.h"
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Class/FinalSpecifiers.h"
+
+namespace Cpp::Class {
+
+namespace {
+
+// Shape <- Polygon <- Square, Shape <- Circle in another namespace
+std::vector<Class> hierarchy()
+{
+    std::vector<Class> classes(4);
+    classes[0].name        = "Shape";
+    classes[0].namespaces  = {"geo"};
+    classes[0].isInterface = true;
+    classes[0].body.emplace_back(Method{"area", Common::Type{"double"}, "", true, true});
+    classes[0].body.emplace_back(
+        Method{"scale", Common::Type{"void"}, "", true, false, false, {Parameter{"factor", Common::Type{"double"}}}});
+
+    classes[1].name       = "Polygon";
+    classes[1].namespaces = {"geo"};
+    classes[1].inherits   = {"Shape"};
+    classes[1].body.emplace_back(Method{"corners", Common::Type{"int"}, "", true});
+
+    classes[2].name       = "Square";
+    classes[2].namespaces = {"geo"};
+    classes[2].inherits   = {"Polygon"};
+    classes[2].body.emplace_back(Method{"area", Common::Type{"double"}, "", false, true});
+    classes[2].body.emplace_back(Method{"corners", Common::Type{"int"}});
+    classes[2].body.emplace_back(
+        Method{"scale", Common::Type{"void"}, "", false, false, false, {Parameter{"factor", Common::Type{"int"}}}});
+    classes[2].body.emplace_back(Method{"side", Common::Type{"double"}});
+
+    classes[3].name       = "Circle";
+    classes[3].namespaces = {"geo", "round"};
+    classes[3].inherits   = {"geo::Shape"};
+    classes[3].body.emplace_back(Method{"area", Common::Type{"double"}, "", false, true});
+    return classes;
+}
+
+bool isFinal(const ClassElement& elem)
+{
+    return std::get<Method>(elem).isFinal;
+}
+
+} // namespace
+
+TEST(FinalSpecifiersTest, DisabledByDefault)
+{
+    // Arrange
+    FinalSpecifiers sut{std::make_shared<Config>()};
+    auto classes = hierarchy();
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    EXPECT_FALSE(classes[2].isFinal);
+    EXPECT_FALSE(isFinal(classes[2].body[0]));
+}
+
+TEST(FinalSpecifiersTest, LeafClasses)
+{
+    // Arrange
+    FinalSpecifiers sut{configWithArguments({"--finalClasses"})};
+    auto classes = hierarchy();
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    EXPECT_FALSE(classes[0].isFinal);
+    EXPECT_FALSE(classes[1].isFinal);
+    EXPECT_TRUE(classes[2].isFinal);
+    EXPECT_TRUE(classes[3].isFinal);
+}
+
+TEST(FinalSpecifiersTest, OverridingMethods)
+{
+    // Arrange
+    FinalSpecifiers sut{configWithArguments({"--finalClasses"})};
+    auto classes = hierarchy();
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    EXPECT_TRUE(isFinal(classes[2].body[0]));  // overrides Shape::area
+    EXPECT_TRUE(isFinal(classes[2].body[1]));  // overrides Polygon::corners
+    EXPECT_FALSE(isFinal(classes[2].body[2])); // other parameter types
+    EXPECT_FALSE(isFinal(classes[2].body[3])); // no base declares it
+    EXPECT_TRUE(isFinal(classes[3].body[0]));
+}
+
+TEST(FinalSpecifiersTest, HierarchyAcrossModels)
+{
+    // Arrange
+    FinalSpecifiers sut{configWithArguments({"--finalClasses"})};
+    auto project = hierarchy();
+    std::vector<Class> polygons{project[1]};
+    std::vector<Class> squares{project[2]};
+
+    // Act
+    sut.index(project);
+    sut.add(polygons);
+    sut.add(squares);
+
+    // Assert
+    EXPECT_FALSE(polygons[0].isFinal); // Square derives from it in another model
+    EXPECT_TRUE(squares[0].isFinal);
+    EXPECT_TRUE(isFinal(squares[0].body[0]));  // overrides Shape::area
+    EXPECT_TRUE(isFinal(squares[0].body[1]));  // overrides Polygon::corners
+    EXPECT_FALSE(isFinal(squares[0].body[2])); // other parameter types
+}
+
+TEST(FinalSpecifiersTest, ClassesWithoutModeledBase)
+{
+    // Arrange
+    FinalSpecifiers sut{configWithArguments({"--finalClasses"})};
+
+    std::vector<Class> classes(2);
+    classes[0].name     = "Plain";
+    classes[1].name     = "Widget";
+    classes[1].inherits = {"QWidget"};
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    EXPECT_FALSE(classes[0].isFinal);
+    EXPECT_FALSE(classes[1].isFinal);
+}
+
+} // namespace Cpp::Class
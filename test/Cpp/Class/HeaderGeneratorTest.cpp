@@ -1,7 +1,10 @@
 #include "gtest/gtest.h"
 
+#include <filesystem>
+#include <fstream>
 #include <regex>
 
+#include "Common/ConfigHelper.h"
 #include "Config.h"
 #include "Cpp/Class/Class.h"
 #include "Cpp/Class/HeaderGenerator.h"
@@ -324,4 +327,113 @@ TEST(ClassHeaderGenerator, Interface)
     EXPECT_TRUE(std::regex_match(output, classRegex)) << output;
 }
 
+TEST(ClassHeaderGenerator, FinalClass)
+{
+    // Arrange
+    auto config = std::make_shared<Config>();
+    HeaderGenerator sut(config);
+
+    Class input;
+    input.name     = "Square";
+    input.isFinal  = true;
+    input.inherits = {"Shape"};
+
+    Method method;
+    method.name       = "area";
+    method.returnType = Common::Type{"double"};
+    method.isFinal    = true;
+    input.body.emplace_back(method);
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    std::string regex = header + "class Square final : public Shape" + ws + "\\{" + ws;
+    regex += "double area\\(\\) final;" + ws;
+    regex += "\\};(.|\n)*";
+    std::regex classRegex(regex);
+    EXPECT_TRUE(std::regex_match(output, classRegex)) << output;
+}
+
+TEST(ClassHeaderGenerator, HashSpecialization)
+{
+    // Arrange
+    auto config = std::make_shared<Config>();
+    HeaderGenerator sut(config);
+
+    Class input;
+    input.name       = "Point";
+    input.namespaces = {"geo"};
+    input.isStruct   = true;
+    input.isHashable = true;
+    input.body.emplace_back(Variable{"x", Common::Type{"int"}});
+    input.body.emplace_back(Variable{"count", Common::Type{"int"}, "", false, true});
+    input.body.emplace_back(Variable{"y", Common::Type{"int"}});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    std::string hash = "} // namespace geo\n\n"
+                       "template <>\n"
+                       "struct std::hash<geo::Point>\n"
+                       "{\n"
+                       "    std::size_t operator()(const geo::Point& value) const noexcept\n"
+                       "    {\n"
+                       "        std::size_t seed = 0;\n"
+                       "        Hash::combine(seed, value.x);\n"
+                       "        Hash::combine(seed, value.y);\n"
+                       "        return seed;\n"
+                       "    }\n"
+                       "};\n";
+    EXPECT_TRUE(output.ends_with(hash)) << output;
+}
+
+TEST(ClassHeaderGenerator, HashSpecializationWithoutPlaceholder)
+{
+    // Arrange
+    auto layout = std::filesystem::temp_directory_path() / "PlantUML2CppClassWithoutHash.template";
+    std::ofstream(layout) << "#pragma once\n\n{{includes}}\n{{definition}}\n{\n{{body}}};\n";
+    HeaderGenerator sut(configWithArguments({"--classHeaderTemplate", layout.string()}));
+
+    Class input;
+    input.name       = "Point";
+    input.isStruct   = true;
+    input.isHashable = true;
+    input.body.emplace_back(Variable{"x", Common::Type{"int"}});
+
+    // Act
+    auto output = sut.generate(input);
+    std::filesystem::remove(layout);
+
+    // Assert
+    EXPECT_NE(output.find("};\n\ntemplate <>\nstruct std::hash<Point>\n"), std::string::npos) << output;
+}
+
+TEST(ClassHeaderGenerator, ForwardDeclarations)
+{
+    // Arrange
+    auto config = std::make_shared<Config>();
+    HeaderGenerator sut(config);
+
+    Class input;
+    input.name                = "simpleClass";
+    input.namespaces          = {"app"};
+    input.externalIncludes    = {"memory"};
+    input.forwardDeclarations = {{"Global"}, {"app::Foo", true}, {"app::Bar"}, {"ns::Baz"}};
+    input.body.emplace_back(Variable{"foo", Common::Type{"std::shared_ptr", {{"Foo"}}}});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    std::string regex = header + "#include <memory>" + ws;
+    regex += "class Global;" + ws;
+    regex += "namespace app \\{" + ws + "class Bar;" + ws + "struct Foo;" + ws + "\\} // namespace app" + ws;
+    regex += "namespace ns \\{" + ws + "class Baz;" + ws + "\\} // namespace ns" + ws;
+    regex += "namespace app \\{" + ws + "class[ \t]*simpleClass" + ws + "\\{(.|\n)*";
+    std::regex classRegex(regex);
+    EXPECT_TRUE(std::regex_match(output, classRegex)) << output;
+}
+
 } // namespace Cpp::Class
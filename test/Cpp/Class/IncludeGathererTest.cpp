@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "Common/ConfigHelper.h"
 #include "Cpp/Class/IncludeGatherer.h"
 
 namespace Cpp::Class {
@@ -80,4 +81,122 @@ TEST(IncludeGathererTest, MultipleFromVariable)
     EXPECT_NE(test.externalIncludes.find("vector"), test.externalIncludes.end());
 }
 
+TEST(IncludeGathererTest, ContainersWithSize)
+{
+    // Arrange
+    IncludeGatherer sut{std::make_shared<Config>()};
+
+    Class test{"Test"};
+    test.body.emplace_back(Variable{"var1", {"std::array", {{"Element"}, {"4"}}}});
+    test.body.emplace_back(Variable{"var2", {"std::optional", {{"Element"}}}});
+
+    // Act
+    sut.gather(test);
+
+    // Assert
+    EXPECT_EQ(test.localIncludes, std::set<std::string>{"Element.h"});
+    EXPECT_EQ(test.externalIncludes, (std::set<std::string>{"array", "optional"}));
+}
+
+TEST(IncludeGathererTest, PointersAndReferences)
+{
+    // Arrange
+    IncludeGatherer sut{std::make_shared<Config>()};
+
+    Class test{"Test"};
+    test.body.emplace_back(Variable{"ptr", Common::Type{"ns::Foo*"}});
+    test.body.emplace_back(Variable{"ref", Common::Type{"Bar &"}});
+
+    // Act
+    sut.gather(test);
+
+    // Assert
+    EXPECT_EQ(test.localIncludes, (std::set<std::string>{"ns/Foo.h", "Bar.h"}));
+    EXPECT_TRUE(test.forwardDeclarations.empty());
+}
+
+TEST(IncludeGathererTest, ForwardDeclarations)
+{
+    // Arrange
+    IncludeGatherer sut{configWithArguments({"--forwardDeclarations"})};
+
+    std::vector<Class> classes(6);
+    classes[0].name       = "Test";
+    classes[0].namespaces = {"app"};
+    classes[1].name       = "Shared";
+    classes[1].namespaces = {"ns"};
+    classes[2].name       = "Weak";
+    classes[2].isStruct   = true;
+    classes[3].name       = "Pointer";
+    classes[4].name       = "Returned";
+    classes[4].namespaces = {"app"};
+    classes[5].name       = "Param";
+    classes[5].namespaces = {"ns"};
+    classes[5].isStruct   = true;
+
+    auto& test = classes[0];
+    test.body.emplace_back(Variable{"shared", Common::Type{"std::shared_ptr", {{"ns::Shared"}}}});
+    test.body.emplace_back(Variable{"weak", Common::Type{"std::weak_ptr", {{"::Weak"}}}});
+    test.body.emplace_back(Variable{"ptr", Common::Type{"Pointer*"}});
+    test.body.emplace_back(Method{"method", Common::Type{"Returned"}, "", false, false, false, {Parameter{"p", {"ns::Param"}}}});
+
+    // Act
+    sut.index(classes);
+    sut.gather(test);
+
+    // Assert
+    EXPECT_TRUE(test.localIncludes.empty());
+    EXPECT_EQ(test.externalIncludes, (std::set<std::string>{"memory"}));
+    EXPECT_EQ(test.forwardDeclarations,
+              (std::set<ForwardDeclaration>{
+                  {"ns::Shared"}, {"Weak", true}, {"Pointer"}, {"app::Returned"}, {"ns::Param", true}}));
+    EXPECT_EQ(test.sourceIncludes,
+              (std::set<std::string>{"ns/Shared.h", "Weak.h", "Pointer.h", "Returned.h", "ns/Param.h"}));
+}
+
+TEST(IncludeGathererTest, OnlyModelClassesAreDeclared)
+{
+    // Arrange
+    IncludeGatherer sut{configWithArguments({"--forwardDeclarations"})};
+
+    std::vector<Class> classes(2);
+    classes[0].name = "Test";
+    classes[1].name = "Model";
+
+    auto& test = classes[0];
+    test.body.emplace_back(Variable{"model", Common::Type{"Model*"}});
+    test.body.emplace_back(Variable{"handle", Common::Type{"Handle", {{"Model"}}}});
+    test.body.emplace_back(Method{"kind", Common::Type{"Kind"}});
+    test.body.emplace_back(Method{"name", Common::Type{"std::string"}});
+
+    // Act
+    sut.index(classes);
+    sut.gather(test);
+
+    // Assert
+    EXPECT_EQ(test.forwardDeclarations, (std::set<ForwardDeclaration>{{"Model"}}));
+    EXPECT_EQ(test.localIncludes, (std::set<std::string>{"Kind.h", "PlantUML2Cpp/Handle.h"}));
+    EXPECT_EQ(test.externalIncludes, (std::set<std::string>{"string"}));
+}
+
+TEST(IncludeGathererTest, CompleteTypeWinsOverDeclaration)
+{
+    // Arrange
+    IncludeGatherer sut{configWithArguments({"--forwardDeclarations"})};
+
+    Class test{"Test"};
+    test.inherits = {"Base"};
+    test.body.emplace_back(Variable{"value", Common::Type{"Value"}});
+    test.body.emplace_back(Variable{"values", Common::Type{"std::vector", {{"Element"}}}});
+    test.body.emplace_back(Method{"method", Common::Type{"Value"}, "", false, false, false, {Parameter{"base", {"Base*"}}}});
+
+    // Act
+    sut.gather(test);
+
+    // Assert
+    EXPECT_EQ(test.localIncludes, (std::set<std::string>{"Base.h", "Value.h", "Element.h"}));
+    EXPECT_TRUE(test.forwardDeclarations.empty());
+    EXPECT_TRUE(test.sourceIncludes.empty());
+}
+
 } // namespace Cpp::Class
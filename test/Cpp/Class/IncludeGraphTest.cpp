@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+
+#include <iostream>
+#include <sstream>
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Class/IncludeGraph.h"
+
+namespace Cpp::Class {
+
+TEST(IncludeGraphTest, CycleBrokenWithForwardDeclaration)
+{
+    // Arrange
+    IncludeGraph sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(2);
+    classes[0].name               = "A";
+    classes[0].localIncludes      = {"B.h"};
+    classes[1].name               = "B";
+    classes[1].localIncludes      = {"A.h"};
+    classes[1].declarableIncludes = {{"A.h", {"A"}}};
+
+    // Act
+    sut.process(classes);
+
+    // Assert
+    EXPECT_EQ(classes[0].localIncludes, (std::set<std::string>{"B.h"}));
+    EXPECT_TRUE(classes[1].localIncludes.empty());
+    EXPECT_EQ(classes[1].forwardDeclarations, (std::set<ForwardDeclaration>{{"A"}}));
+    EXPECT_EQ(classes[1].sourceIncludes, (std::set<std::string>{"A.h"}));
+}
+
+TEST(IncludeGraphTest, CycleAcrossModelsBrokenByIndex)
+{
+    // Arrange
+    IncludeGraph sut{std::make_shared<Config>()};
+
+    std::vector<Class> project(2);
+    project[0].name               = "A";
+    project[0].localIncludes      = {"B.h"};
+    project[1].name               = "B";
+    project[1].localIncludes      = {"A.h"};
+    project[1].declarableIncludes = {{"A.h", {"A"}}};
+    std::vector<Class> first{project[0]};
+    std::vector<Class> second{project[1]};
+
+    // Act
+    sut.index(project);
+    sut.apply(first);
+    sut.apply(second);
+
+    // Assert
+    EXPECT_EQ(first[0].localIncludes, (std::set<std::string>{"B.h"}));
+    EXPECT_TRUE(second[0].localIncludes.empty());
+    EXPECT_EQ(second[0].forwardDeclarations, (std::set<ForwardDeclaration>{{"A"}}));
+    EXPECT_EQ(second[0].sourceIncludes, (std::set<std::string>{"A.h"}));
+}
+
+TEST(IncludeGraphTest, NoCycleKeepsIncludes)
+{
+    // Arrange
+    IncludeGraph sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(3);
+    classes[0].name               = "A";
+    classes[0].localIncludes      = {"B.h", "C.h"};
+    classes[0].declarableIncludes = {{"C.h", {"C"}}};
+    classes[1].name               = "B";
+    classes[1].localIncludes      = {"C.h"};
+    classes[2].name               = "C";
+
+    // Act
+    sut.process(classes);
+
+    // Assert
+    EXPECT_EQ(classes[0].localIncludes, (std::set<std::string>{"B.h", "C.h"}));
+    EXPECT_TRUE(classes[0].forwardDeclarations.empty());
+}
+
+TEST(IncludeGraphTest, IncludesResolvedInNamespaceOfClass)
+{
+    // Arrange
+    IncludeGraph sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(2);
+    classes[0].name               = "A";
+    classes[0].namespaces         = {"ns"};
+    classes[0].localIncludes      = {"B.h"};
+    classes[0].declarableIncludes = {{"B.h", {"ns::B", true}}};
+    classes[1].name               = "B";
+    classes[1].namespaces         = {"ns"};
+    classes[1].localIncludes      = {"ns/A.h"};
+
+    // Act
+    sut.process(classes);
+
+    // Assert
+    EXPECT_TRUE(classes[0].localIncludes.empty());
+    EXPECT_EQ(classes[0].forwardDeclarations, (std::set<ForwardDeclaration>{{"ns::B", true}}));
+    EXPECT_EQ(classes[1].localIncludes, (std::set<std::string>{"ns/A.h"}));
+}
+
+TEST(IncludeGraphTest, TransitiveReduction)
+{
+    // Arrange
+    IncludeGraph sut{configWithArguments({"--minimizeIncludes"})};
+
+    std::vector<Class> classes(4);
+    classes[0].name          = "A";
+    classes[0].localIncludes = {"B.h", "C.h", "D.h", "External.h"};
+    classes[1].name          = "B";
+    classes[1].localIncludes = {"C.h"};
+    classes[2].name          = "C";
+    classes[2].localIncludes = {"D.h"};
+    classes[3].name          = "D";
+
+    // Act
+    sut.process(classes);
+
+    // Assert
+    EXPECT_EQ(classes[0].localIncludes, (std::set<std::string>{"B.h", "External.h"}));
+    EXPECT_EQ(classes[1].localIncludes, (std::set<std::string>{"C.h"}));
+    EXPECT_EQ(classes[2].localIncludes, (std::set<std::string>{"D.h"}));
+}
+
+TEST(IncludeGraphTest, Report)
+{
+    // Arrange
+    IncludeGraph sut{configWithArguments({"--includeReport"})};
+
+    std::vector<Class> classes(3);
+    classes[0].name          = "A";
+    classes[0].localIncludes = {"C.h"};
+    classes[1].name          = "B";
+    classes[1].localIncludes = {"C.h"};
+    classes[2].name          = "C";
+
+    std::ostringstream out;
+    auto* coutBuffer = std::cout.rdbuf(out.rdbuf());
+
+    // Act
+    sut.process(classes);
+    sut.report(classes);
+    std::cout.rdbuf(coutBuffer);
+
+    // Assert
+    auto report = out.str();
+    EXPECT_NE(report.find("3 headers, 2 includes"), std::string::npos) << report;
+    EXPECT_NE(report.find("         2       2        0  C.h"), std::string::npos) << report;
+    EXPECT_LT(report.find("C.h"), report.find("A.h")) << report;
+}
+
+} // namespace Cpp::Class
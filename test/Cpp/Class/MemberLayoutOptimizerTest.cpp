@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Class/MemberLayoutOptimizer.h"
+
+namespace Cpp::Class {
+
+TEST(MemberLayoutOptimizerTest, DisabledByDefault)
+{
+    // Arrange
+    MemberLayoutOptimizer sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name = "Test";
+    classes[0].body.emplace_back(Variable{"flag", Common::Type{"bool"}});
+    classes[0].body.emplace_back(Variable{"value", Common::Type{"double"}});
+
+    // Act
+    sut.optimize(classes);
+
+    // Assert
+    ASSERT_EQ(classes[0].body.size(), 2);
+    EXPECT_EQ(std::get<Variable>(classes[0].body[0]).name, "flag");
+}
+
+TEST(MemberLayoutOptimizerTest, ReorderWithinSections)
+{
+    // Arrange
+    MemberLayoutOptimizer sut{configWithArguments({"--optimizeMemberLayout"})};
+
+    std::vector<Class> classes(1);
+    classes[0].name = "Test";
+    classes[0].body.emplace_back(VisibilityKeyword{"public:"});
+    classes[0].body.emplace_back(Variable{"a", Common::Type{"bool"}});
+    classes[0].body.emplace_back(Variable{"b", Common::Type{"double"}});
+    classes[0].body.emplace_back(Method{"method", Common::Type{"void"}});
+    classes[0].body.emplace_back(Variable{"c", Common::Type{"int"}});
+    classes[0].body.emplace_back(VisibilityKeyword{"private:"});
+    classes[0].body.emplace_back(Variable{"d", Common::Type{"char"}});
+    classes[0].body.emplace_back(Variable{"e", Common::Type{"std::string"}});
+    classes[0].body.emplace_back(Variable{"f", Common::Type{"char"}});
+
+    // Act
+    sut.optimize(classes);
+
+    // Assert
+    const auto& body = classes[0].body;
+    ASSERT_EQ(body.size(), 10);
+    EXPECT_EQ(std::get<std::string>(body[0]), "    // estimated sizeof: 56 bytes (64 bytes before reordering the members)");
+    EXPECT_EQ(std::get<Variable>(body[2]).name, "b");
+    EXPECT_EQ(std::get<Variable>(body[3]).name, "c");
+    EXPECT_EQ(std::get<Method>(body[4]).name, "method");
+    EXPECT_EQ(std::get<Variable>(body[5]).name, "a");
+    EXPECT_EQ(std::get<Variable>(body[7]).name, "e");
+    EXPECT_EQ(std::get<Variable>(body[8]).name, "d");
+    EXPECT_EQ(std::get<Variable>(body[9]).name, "f");
+}
+
+TEST(MemberLayoutOptimizerTest, ModelTypesByValue)
+{
+    // Arrange
+    MemberLayoutOptimizer sut{configWithArguments({"--optimizeMemberLayout"})};
+
+    std::vector<Class> classes(2);
+    classes[0].name = "Outer";
+    classes[0].body.emplace_back(Variable{"flag", Common::Type{"bool"}});
+    classes[0].body.emplace_back(Variable{"inner", Common::Type{"ns::Inner"}});
+    classes[1].name       = "Inner";
+    classes[1].namespaces = {"ns"};
+    classes[1].body.emplace_back(Variable{"a", Common::Type{"char"}});
+    classes[1].body.emplace_back(Variable{"b", Common::Type{"int"}});
+    classes[1].body.emplace_back(Variable{"c", Common::Type{"char"}});
+
+    // Act
+    sut.optimize(classes);
+
+    // Assert
+    EXPECT_EQ(std::get<std::string>(classes[1].body[0]),
+              "    // estimated sizeof: 8 bytes (12 bytes before reordering the members)");
+    EXPECT_EQ(std::get<std::string>(classes[0].body[0]),
+              "    // estimated sizeof: 12 bytes (12 bytes before reordering the members)");
+    EXPECT_EQ(std::get<Variable>(classes[0].body[1]).name, "inner");
+}
+
+TEST(MemberLayoutOptimizerTest, UnknownTypeKeepsOrder)
+{
+    // Arrange
+    MemberLayoutOptimizer sut{configWithArguments({"--optimizeMemberLayout"})};
+
+    std::vector<Class> classes(1);
+    classes[0].name = "Test";
+    classes[0].body.emplace_back(Variable{"flag", Common::Type{"bool"}});
+    classes[0].body.emplace_back(Variable{"unknown", Common::Type{"Unknown"}});
+    classes[0].body.emplace_back(Variable{"value", Common::Type{"double"}});
+
+    // Act
+    sut.optimize(classes);
+
+    // Assert
+    ASSERT_EQ(classes[0].body.size(), 3);
+    EXPECT_EQ(std::get<Variable>(classes[0].body[0]).name, "flag");
+}
+
+} // namespace Cpp::Class
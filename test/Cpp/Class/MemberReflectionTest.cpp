@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Class/MemberReflection.h"
+
+namespace Cpp::Class {
+
+TEST(MemberReflectionTest, DisabledByDefault)
+{
+    // Arrange
+    MemberReflection sut{std::make_shared<Config>()};
+
+    Class input;
+    input.name = "Test";
+    input.body.emplace_back(Variable{"value", Common::Type{"int"}});
+
+    // Act
+    sut.add(input);
+
+    // Assert
+    EXPECT_EQ(input.body.size(), 1);
+    EXPECT_TRUE(input.externalIncludes.empty());
+}
+
+TEST(MemberReflectionTest, DataMembersOfClass)
+{
+    // Arrange
+    MemberReflection sut{configWithArguments({"--memberReflection"})};
+
+    Class input;
+    input.name = "Point";
+    input.body.emplace_back(VisibilityKeyword{"public:"});
+    input.body.emplace_back(Method{"length", Common::Type{"double"}});
+    input.body.emplace_back(VisibilityKeyword{"private:"});
+    input.body.emplace_back(Variable{"x", Common::Type{"int"}});
+    input.body.emplace_back(Variable{"count", Common::Type{"int"}, "", false, true});
+    input.body.emplace_back(Variable{"origin", Common::Type{"Point&"}});
+    input.body.emplace_back(Variable{"y", Common::Type{"int"}, "", true});
+
+    // Act
+    sut.add(input);
+
+    // Assert
+    const auto& body = input.body;
+    ASSERT_EQ(body.size(), 10);
+    EXPECT_EQ(std::get<std::string>(body[7]), "");
+    EXPECT_EQ(std::get<VisibilityKeyword>(body[8]).name, "public:");
+    EXPECT_EQ(std::get<std::string>(body[9]),
+              "    // names and pointers of the data members in declaration order\n"
+              "    static constexpr auto reflectMembers()\n"
+              "    {\n"
+              "        return std::tuple{\n"
+              "            std::pair{std::string_view{\"x\"}, &Point::m_x},\n"
+              "            std::pair{std::string_view{\"y\"}, &Point::m_y}};\n"
+              "    }");
+    EXPECT_EQ(input.externalIncludes, (std::set<std::string>{"string_view", "tuple", "utility"}));
+}
+
+TEST(MemberReflectionTest, StructWithoutPrefix)
+{
+    // Arrange
+    MemberReflection sut{configWithArguments({"--memberReflection"})};
+
+    Class input;
+    input.name     = "Point";
+    input.isStruct = true;
+    input.body.emplace_back(Variable{"x", Common::Type{"int"}});
+
+    // Act
+    sut.add(input);
+
+    // Assert
+    const auto& body = input.body;
+    ASSERT_EQ(body.size(), 3);
+    EXPECT_NE(std::get<std::string>(body[2]).find("std::pair{std::string_view{\"x\"}, &Point::x}};"),
+              std::string::npos);
+}
+
+TEST(MemberReflectionTest, EmptyClass)
+{
+    // Arrange
+    MemberReflection sut{configWithArguments({"--memberReflection"})};
+
+    Class input;
+    input.name = "Empty";
+
+    // Act
+    sut.add(input);
+
+    // Assert
+    const auto& body = input.body;
+    ASSERT_EQ(body.size(), 2);
+    EXPECT_EQ(std::get<VisibilityKeyword>(body[0]).name, "public:");
+    EXPECT_NE(std::get<std::string>(body[1]).find("return std::tuple{};"), std::string::npos);
+}
+
+TEST(MemberReflectionTest, NotForInterfaces)
+{
+    // Arrange
+    MemberReflection sut{configWithArguments({"--memberReflection"})};
+
+    Class input;
+    input.name        = "Shape";
+    input.isInterface = true;
+
+    // Act
+    sut.add(input);
+
+    // Assert
+    EXPECT_TRUE(input.body.empty());
+}
+
+} // namespace Cpp::Class
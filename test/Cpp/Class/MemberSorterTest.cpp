@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "Common/ConfigHelper.h"
 #include "Cpp/Class/MemberSorter.h"
 
 namespace Cpp {
@@ -8,7 +9,7 @@ namespace Class {
 TEST(MemberSorterTest, NoPrimitives)
 {
     // Arrange
-    MemberSorter sut;
+    MemberSorter sut{std::make_shared<Config>()};
 
     Class test{"Test"};
     test.body.emplace_back(Variable{"var1", {"int"}});
@@ -27,5 +28,76 @@ TEST(MemberSorterTest, NoPrimitives)
     EXPECT_EQ(std::get<VisibilityKeyword>(test.body[6]).name, "public:");
 }
 
+TEST(MemberSorterTest, ExplicitVisibilityUntouched)
+{
+    // Arrange
+    MemberSorter sut{std::make_shared<Config>()};
+
+    Class test{"Test"};
+    test.body.emplace_back(VisibilityKeyword{"protected:"});
+    test.body.emplace_back(Variable{"var1", {"int"}});
+    test.body.emplace_back(Method{"method1", {"int"}});
+
+    // Act
+    sut.sort(test);
+
+    // Assert
+    EXPECT_EQ(test.body.size(), 3);
+}
+
+TEST(MemberSorterTest, GroupByVisibility)
+{
+    // Arrange
+    MemberSorter sut{configWithArguments({"--groupByVisibility"})};
+
+    Class test{"Test"};
+    test.body.emplace_back(Variable{"var1", {"int"}});
+    test.body.emplace_back(VisibilityKeyword{"private:"});
+    test.body.emplace_back(Method{"privateMethod", {"int"}});
+    test.body.emplace_back(VisibilityKeyword{"public:"});
+    test.body.emplace_back(Variable{"var2", {"int"}});
+    test.body.emplace_back(Separator{"separator"});
+    test.body.emplace_back(Method{"publicMethod", {"int"}});
+    test.body.emplace_back(VisibilityKeyword{"protected:"});
+    test.body.emplace_back(Variable{"var3", {"int"}});
+    test.body.emplace_back(VisibilityKeyword{""});
+    test.body.emplace_back(Method{"method", {"int"}});
+
+    // Act
+    sut.sort(test);
+
+    // Assert
+    ASSERT_EQ(test.body.size(), 10);
+    EXPECT_EQ(std::get<VisibilityKeyword>(test.body[0]).name, "public:");
+    EXPECT_EQ(std::get<Separator>(test.body[1]).text, "separator");
+    EXPECT_EQ(std::get<Method>(test.body[2]).name, "publicMethod");
+    EXPECT_EQ(std::get<Method>(test.body[3]).name, "method");
+    EXPECT_EQ(std::get<Variable>(test.body[4]).name, "var2");
+    EXPECT_EQ(std::get<VisibilityKeyword>(test.body[5]).name, "protected:");
+    EXPECT_EQ(std::get<Variable>(test.body[6]).name, "var3");
+    EXPECT_EQ(std::get<VisibilityKeyword>(test.body[7]).name, "private:");
+    EXPECT_EQ(std::get<Method>(test.body[8]).name, "privateMethod");
+    EXPECT_EQ(std::get<Variable>(test.body[9]).name, "var1");
+}
+
+TEST(MemberSorterTest, GroupByVisibilityInStruct)
+{
+    // Arrange
+    MemberSorter sut{configWithArguments({"--groupByVisibility"})};
+
+    Class test{"Test"};
+    test.isStruct = true;
+    test.body.emplace_back(Variable{"var", {"int"}});
+    test.body.emplace_back(Method{"method", {"int"}});
+
+    // Act
+    sut.sort(test);
+
+    // Assert
+    ASSERT_EQ(test.body.size(), 2);
+    EXPECT_EQ(std::get<Method>(test.body[0]).name, "method");
+    EXPECT_EQ(std::get<Variable>(test.body[1]).name, "var");
+}
+
 } // namespace Class
 } // namespace Cpp
@@ -167,4 +167,24 @@ TEST(SourceGenerator, MultiMethodClass)
     EXPECT_TRUE(std::regex_match(output, classRegex)) << output;
 }
 
+TEST(SourceGenerator, IncludesForwardDeclaredTypes)
+{
+    // Arrange
+    auto config = std::make_shared<Config>();
+    SourceGenerator sut(config);
+
+    Class input;
+    input.name           = "test";
+    input.sourceIncludes = {"ns/Foo.h"};
+    input.body.emplace_back(Method{"method", Common::Type{"ns::Foo"}});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    std::string regex = header + "#include \"ns/Foo.h\"" + ws + "ns::Foo test::method\\(\\) \\{\\}" + ws;
+    std::regex classRegex(regex);
+    EXPECT_TRUE(std::regex_match(output, classRegex)) << output;
+}
+
 } // namespace Cpp::Class
@@ -0,0 +1,166 @@
+#include "gtest/gtest.h"
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Class/SpecialMembers.h"
+
+namespace Cpp::Class {
+
+namespace {
+
+std::vector<std::string> strings(const Class& c)
+{
+    std::vector<std::string> out;
+    for (const auto& elem : c.body) {
+        if (std::holds_alternative<std::string>(elem)) {
+            out.push_back(std::get<std::string>(elem));
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(SpecialMembersTest, DisabledByDefault)
+{
+    // Arrange
+    SpecialMembers sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name = "Test";
+    classes[0].body.emplace_back(VisibilityKeyword{"private:"});
+    classes[0].body.emplace_back(Variable{"value", Common::Type{"int"}});
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    EXPECT_EQ(classes[0].body.size(), 2);
+}
+
+TEST(SpecialMembersTest, DefaultedWithNoexceptMoves)
+{
+    // Arrange
+    SpecialMembers sut{configWithArguments({"--specialMembers"})};
+
+    std::vector<Class> classes(1);
+    classes[0].name = "Test";
+    classes[0].body.emplace_back(VisibilityKeyword{"private:"});
+    classes[0].body.emplace_back(Variable{"values", Common::Type{"std::vector", {{"std::string"}}}});
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    const auto& body = classes[0].body;
+    ASSERT_EQ(body.size(), 10);
+    EXPECT_EQ(std::get<VisibilityKeyword>(body[0]).name, "public:");
+    EXPECT_EQ(strings(classes[0]),
+              (std::vector<std::string>{"    Test() = default;",
+                                        "    ~Test() = default;",
+                                        "    Test(const Test&) = default;",
+                                        "    Test& operator=(const Test&) = default;",
+                                        "    Test(Test&&) noexcept = default;",
+                                        "    Test& operator=(Test&&) noexcept = default;",
+                                        ""}));
+    EXPECT_EQ(std::get<VisibilityKeyword>(body[8]).name, "private:");
+    EXPECT_EQ(std::get<Variable>(body[9]).name, "values");
+}
+
+TEST(SpecialMembersTest, IntoExistingPublicSection)
+{
+    // Arrange
+    SpecialMembers sut{configWithArguments({"--specialMembers"})};
+
+    std::vector<Class> classes(1);
+    classes[0].name = "Test";
+    classes[0].body.emplace_back(VisibilityKeyword{"public:"});
+    classes[0].body.emplace_back(Method{"method", Common::Type{"void"}});
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    const auto& body = classes[0].body;
+    ASSERT_EQ(body.size(), 9);
+    EXPECT_EQ(std::get<VisibilityKeyword>(body[0]).name, "public:");
+    EXPECT_EQ(std::get<std::string>(body[1]), "    Test() = default;");
+    EXPECT_EQ(std::get<std::string>(body[7]), "");
+    EXPECT_EQ(std::get<Method>(body[8]).name, "method");
+}
+
+TEST(SpecialMembersTest, OnlyForStereotype)
+{
+    // Arrange
+    SpecialMembers sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(2);
+    classes[0].name       = "Marked";
+    classes[0].stereotype = "RuleOfFive";
+    classes[0].isStruct   = true;
+    classes[1].name       = "Unmarked";
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    EXPECT_EQ(classes[0].body.size(), 6);
+    EXPECT_TRUE(classes[1].body.empty());
+}
+
+TEST(SpecialMembersTest, MemberTypesFromModel)
+{
+    // Arrange
+    SpecialMembers sut{configWithArguments({"--specialMembers"})};
+
+    std::vector<Class> classes(4);
+    classes[0].name       = "Owner";
+    classes[0].namespaces = {"ns"};
+    classes[0].body.emplace_back(Variable{"resource", Common::Type{"Resource"}});
+    classes[1].name       = "Resource";
+    classes[1].namespaces = {"ns"};
+    classes[1].body.emplace_back(Variable{"data", Common::Type{"std::unique_ptr", {{"std::mutex"}}}});
+    classes[2].name = "Locked";
+    classes[2].body.emplace_back(Variable{"mutex", Common::Type{"std::mutex"}});
+    classes[3].name = "Lookup";
+    classes[3].inherits.push_back("ns::Owner");
+    classes[3].body.emplace_back(
+        Variable{"entries", Common::Type{"std::optional", {{"std::map", {{"int"}, {"int"}}}}}});
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    auto owner = strings(classes[0]);
+    ASSERT_EQ(owner.size(), 6);
+    EXPECT_EQ(owner[2], "    Owner(const Owner&) = delete;");
+    EXPECT_EQ(owner[4], "    Owner(Owner&&) noexcept = default;");
+
+    auto locked = strings(classes[2]);
+    ASSERT_EQ(locked.size(), 6);
+    EXPECT_EQ(locked[2], "    Locked(const Locked&) = delete;");
+    EXPECT_EQ(locked[4], "    Locked(Locked&&) = delete;");
+
+    auto lookup = strings(classes[3]);
+    ASSERT_EQ(lookup.size(), 6);
+    EXPECT_EQ(lookup[2], "    Lookup(const Lookup&) = delete;");
+    EXPECT_EQ(lookup[4], "    Lookup(Lookup&&) = default;");
+}
+
+TEST(SpecialMembersTest, VirtualDestructorForInterfaces)
+{
+    // Arrange
+    SpecialMembers sut{configWithArguments({"--specialMembers"})};
+
+    std::vector<Class> classes(1);
+    classes[0].name        = "Interface";
+    classes[0].isInterface = true;
+    classes[0].body.emplace_back(Method{"method", Common::Type{"void"}, "", true});
+
+    // Act
+    sut.add(classes);
+
+    // Assert
+    EXPECT_EQ(strings(classes[0])[1], "    virtual ~Interface() = default;");
+}
+
+} // namespace Cpp::Class
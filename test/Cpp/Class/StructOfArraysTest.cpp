@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+
+#include "Cpp/Class/StructOfArrays.h"
+
+namespace Cpp::Class {
+
+TEST(StructOfArraysTest, OnlyForSoAStereotype)
+{
+    // Arrange
+    StructOfArrays sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name     = "Particle";
+    classes[0].isStruct = true;
+    classes[0].body.emplace_back(Variable{"x", Common::Type{"float"}});
+
+    // Act
+    sut.addCompanions(classes);
+
+    // Assert
+    EXPECT_EQ(classes.size(), 1);
+}
+
+TEST(StructOfArraysTest, OneColumnPerDataMember)
+{
+    // Arrange
+    StructOfArrays sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name       = "Particle";
+    classes[0].stereotype = "SoA";
+    classes[0].isStruct   = true;
+    classes[0].namespaces = {"ns"};
+    classes[0].body.emplace_back(Variable{"x", Common::Type{"float"}});
+    classes[0].body.emplace_back(Method{"length", Common::Type{"float"}});
+    classes[0].body.emplace_back(Variable{"alive", Common::Type{"bool"}});
+    classes[0].body.emplace_back(Variable{"count", Common::Type{"int"}, "", false, true});
+
+    // Act
+    sut.addCompanions(classes);
+
+    // Assert
+    ASSERT_EQ(classes.size(), 2);
+
+    const auto& soa = classes[1];
+    EXPECT_EQ(soa.name, "ParticleSoA");
+    EXPECT_TRUE(soa.isStruct);
+    EXPECT_EQ(soa.namespaces, std::list<std::string>{"ns"});
+    EXPECT_TRUE(soa.localIncludes.contains("Particle.h"));
+
+    ASSERT_GT(soa.body.size(), 2);
+    EXPECT_EQ(std::get<Variable>(soa.body[0]).name, "x");
+    EXPECT_EQ(std::get<Variable>(soa.body[0]).type, (Common::Type{"std::vector", {{"float"}}}));
+    EXPECT_EQ(std::get<Variable>(soa.body[1]).name, "alive");
+    EXPECT_FALSE(std::holds_alternative<Variable>(soa.body[2]));
+}
+
+TEST(StructOfArraysTest, AccessorProxy)
+{
+    // Arrange
+    StructOfArrays sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name       = "Particle";
+    classes[0].stereotype = "SoA";
+    classes[0].isStruct   = true;
+    classes[0].body.emplace_back(Variable{"x", Common::Type{"float"}});
+    classes[0].body.emplace_back(Variable{"y", Common::Type{"float"}});
+
+    // Act
+    sut.addCompanions(classes);
+
+    // Assert
+    ASSERT_EQ(classes.size(), 2);
+
+    std::string body;
+    for (const auto& elem : classes[1].body) {
+        if (std::holds_alternative<std::string>(elem)) {
+            body += std::get<std::string>(elem) + "\n";
+        }
+    }
+    EXPECT_NE(body.find("    struct Reference\n"
+                        "    {\n"
+                        "        decltype(ParticleSoA::x)::reference x;\n"
+                        "        decltype(ParticleSoA::y)::reference y;\n"
+                        "    };\n"),
+              std::string::npos);
+    EXPECT_NE(body.find("    void push_back(const Particle& element)\n"
+                        "    {\n"
+                        "        x.push_back(element.x);\n"
+                        "        y.push_back(element.y);\n"
+                        "    }\n"),
+              std::string::npos);
+    EXPECT_NE(body.find("    Reference operator[](size_t index) { return {x[index], y[index]}; }\n"),
+              std::string::npos);
+}
+
+TEST(StructOfArraysTest, NoCompanionForPrivateMembers)
+{
+    // Arrange
+    StructOfArrays sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name       = "Particle";
+    classes[0].stereotype = "SoA";
+    classes[0].body.emplace_back(Variable{"x", Common::Type{"float"}});
+
+    // Act
+    sut.addCompanions(classes);
+
+    // Assert
+    EXPECT_EQ(classes.size(), 1);
+}
+
+TEST(StructOfArraysTest, ElementKeepsItsPrefix)
+{
+    // Arrange
+    StructOfArrays sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name       = "Particle";
+    classes[0].stereotype = "SoA";
+    classes[0].body.emplace_back(VisibilityKeyword{"public:"});
+    classes[0].body.emplace_back(Variable{"x", Common::Type{"float"}});
+
+    // Act
+    sut.addCompanions(classes);
+
+    // Assert
+    ASSERT_EQ(classes.size(), 2);
+
+    std::string body;
+    for (const auto& elem : classes[1].body) {
+        if (std::holds_alternative<std::string>(elem)) {
+            body += std::get<std::string>(elem) + "\n";
+        }
+    }
+    EXPECT_NE(body.find("        x.push_back(element.m_x);\n"), std::string::npos);
+    EXPECT_NE(body.find("        element.m_x = x[index];\n"), std::string::npos);
+}
+
+TEST(StructOfArraysTest, NoCompanionWithoutDataMembers)
+{
+    // Arrange
+    StructOfArrays sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name       = "Empty";
+    classes[0].stereotype = "SoA";
+
+    // Act
+    sut.addCompanions(classes);
+
+    // Assert
+    EXPECT_EQ(classes.size(), 1);
+}
+
+} // namespace Cpp::Class
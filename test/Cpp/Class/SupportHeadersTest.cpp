@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Class/SupportHeaders.h"
+
+namespace Cpp::Class {
+
+TEST(SupportHeadersTest, NothingWithoutIncludes)
+{
+    // Arrange
+    SupportHeaders sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(1);
+    classes[0].localIncludes = {"Element.h"};
+
+    // Act
+    auto files = sut.generate(classes);
+
+    // Assert
+    EXPECT_TRUE(files.empty());
+}
+
+TEST(SupportHeadersTest, PoolWithHandle)
+{
+    // Arrange
+    SupportHeaders sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(2);
+    classes[1].localIncludes = {"PlantUML2Cpp/Handle.h"};
+
+    // Act
+    auto files = sut.generate(classes);
+
+    // Assert
+    ASSERT_EQ(files.size(), 2);
+    EXPECT_EQ(files[0].path.parent_path().filename(), "PlantUML2Cpp");
+    EXPECT_EQ(files[0].path.filename(), "Handle.h");
+    EXPECT_EQ(files[1].path.filename(), "ObjectPool.h");
+    EXPECT_NE(files[1].content.find("#include \"Handle.h\""), std::string::npos);
+}
+
+TEST(SupportHeadersTest, ConfiguredIndent)
+{
+    // Arrange
+    SupportHeaders sut{configWithArguments({"--indent", "\t"})};
+
+    std::vector<Class> classes(1);
+    classes[0].localIncludes  = {"PlantUML2Cpp/RefCounted.h"};
+    classes[0].sourceIncludes = {"PlantUML2Cpp/IntrusivePtr.h"};
+
+    // Act
+    auto files = sut.generate(classes);
+
+    // Assert
+    ASSERT_EQ(files.size(), 2);
+    EXPECT_EQ(files[0].path.filename(), "RefCounted.h");
+    EXPECT_NE(files[0].content.find("\n\tmutable std::uint32_t m_references = 0;\n"), std::string::npos);
+    EXPECT_EQ(files[1].path.filename(), "IntrusivePtr.h");
+    EXPECT_NE(files[1].content.find("\n\t\tif (m_object) {\n\t\t\tm_object->addReference();\n"), std::string::npos);
+}
+
+TEST(SupportHeadersTest, ConfiguredExtension)
+{
+    // Arrange
+    SupportHeaders sut{configWithArguments({"--headerExt", "hpp"})};
+
+    std::vector<Class> classes(1);
+    classes[0].localIncludes = {"PlantUML2Cpp/Handle.hpp"};
+
+    // Act
+    auto files = sut.generate(classes);
+
+    // Assert
+    ASSERT_EQ(files.size(), 2);
+    EXPECT_EQ(files[0].path.filename(), "Handle.hpp");
+    EXPECT_EQ(files[1].path.filename(), "ObjectPool.hpp");
+    EXPECT_NE(files[1].content.find("#include \"Handle.hpp\"\n"), std::string::npos);
+    EXPECT_EQ(SupportHeaders::includeOfType("IntrusivePtr", *configWithArguments({"--headerExt", "hpp"})),
+              "PlantUML2Cpp/IntrusivePtr.hpp");
+}
+
+TEST(SupportHeadersTest, WireForStructsWithWireFormat)
+{
+    // Arrange
+    SupportHeaders sut{std::make_shared<Config>()};
+
+    std::vector<Class> classes(2);
+    classes[1].hasWireFormat = true;
+
+    // Act
+    auto files = sut.generate(classes);
+
+    // Assert
+    ASSERT_EQ(files.size(), 1);
+    EXPECT_EQ(files[0].path.filename(), "Wire.h");
+    EXPECT_NE(files[0].content.find("namespace Wire {"), std::string::npos);
+}
+
+} // namespace Cpp::Class
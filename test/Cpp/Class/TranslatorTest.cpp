@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "Common/ConfigHelper.h"
 #include "Cpp/Class/Translator.h"
 #include "PlantUml/Parser.h"
 #include "spdlog/spdlog.h"
@@ -8,10 +9,10 @@ namespace puml = PlantUml;
 
 namespace Cpp::Class {
 
-auto act(std::string_view puml)
+auto act(std::string_view puml, std::shared_ptr<Config> config = std::make_shared<Config>())
 {
     spdlog::set_level(spdlog::level::trace);
-    Translator sut{std::make_shared<Config>()};
+    Translator sut{std::move(config)};
     PlantUml::Parser parser;
     EXPECT_TRUE(parser.parse(puml));
     parser.getAST().visit(sut);
@@ -215,6 +216,81 @@ TEST(ClassTranslatorTest, Composition)
     EXPECT_EQ(std::get<Variable>(classes[0].body[0]).type, Common::Type{"Class04"});
 }
 
+TEST(ClassTranslatorTest, CompositionOfStructOfArrays)
+{
+    // Arrange
+    static constexpr auto puml =
+        R"(@startuml
+        class World
+        World *-- "0..*" Particle
+        World *-- "1" Particle : origin
+        class Particle <<(S,#FF7700) SoA>> {
+            +x : float
+        }
+        @enduml)";
+
+    // Act
+    auto classes = act(puml);
+
+    // Assert
+    ASSERT_EQ(classes.size(), 2);
+
+    EXPECT_TRUE(classes[1].isStruct);
+    EXPECT_EQ(classes[1].stereotype, "SoA");
+
+    ASSERT_EQ(classes[0].body.size(), 2);
+    EXPECT_EQ(std::get<Variable>(classes[0].body[0]).type, Common::Type{"ParticleSoA"});
+    EXPECT_EQ(std::get<Variable>(classes[0].body[1]).type, Common::Type{"Particle"});
+}
+
+TEST(ClassTranslatorTest, CompositionOfStructOfArraysWithPrivateMembers)
+{
+    // Arrange
+    static constexpr auto puml =
+        R"(@startuml
+        class World
+        World *-- "0..*" Particle
+        class Particle <<(S,#FF7700) SoA>> {
+            -x : float
+        }
+        @enduml)";
+
+    // Act
+    auto classes = act(puml);
+
+    // Assert
+    ASSERT_EQ(classes.size(), 2);
+    ASSERT_EQ(classes[0].body.size(), 1);
+    EXPECT_EQ(std::get<Variable>(classes[0].body[0]).type, (Common::Type{"std::vector", {{"Particle"}}}));
+}
+
+TEST(ClassTranslatorTest, CompositionOfStructOfArraysInOtherModel)
+{
+    // Arrange
+    static constexpr auto puml =
+        R"(@startuml
+        class World
+        World *-- "0..*" Particle
+        World *-- "0..*" Mesh
+        @enduml)";
+    Common::ModelIndex<bool> companions;
+    companions.add({}, "Particle", true);
+
+    Translator sut{std::make_shared<Config>()};
+    PlantUml::Parser parser;
+    ASSERT_TRUE(parser.parse(puml));
+    parser.getAST().visit(sut);
+
+    // Act
+    auto classes = std::move(sut).results(companions);
+
+    // Assert
+    ASSERT_EQ(classes.size(), 1);
+    ASSERT_EQ(classes[0].body.size(), 2);
+    EXPECT_EQ(std::get<Variable>(classes[0].body[0]).type, Common::Type{"ParticleSoA"});
+    EXPECT_EQ(std::get<Variable>(classes[0].body[1]).type, (Common::Type{"std::vector", {{"Mesh"}}}));
+}
+
 TEST(ClassTranslatorTest, Aggregation)
 {
     // Arrange
@@ -236,6 +312,28 @@ TEST(ClassTranslatorTest, Aggregation)
     EXPECT_EQ(std::get<Variable>(classes[0].body[0]).type, (Common::Type{"std::shared_ptr", {{"Class06"}}}));
 }
 
+TEST(ClassTranslatorTest, IntrusiveAggregation)
+{
+    // Arrange
+    static constexpr auto puml =
+        R"(@startuml
+        class Scene
+        Scene o-- "0..*" Mesh
+        class Mesh
+        @enduml)";
+
+    // Act
+    auto classes = act(puml, configWithArguments({"--aggregationPolicy", "intrusive"}));
+
+    // Assert
+    ASSERT_EQ(classes.size(), 2);
+
+    ASSERT_EQ(classes[0].body.size(), 1);
+    EXPECT_EQ(std::get<Variable>(classes[0].body[0]).type,
+              (Common::Type{"std::vector", {{"IntrusivePtr", {{"Mesh"}}}}}));
+    EXPECT_EQ(classes[1].inherits, std::vector<std::string>{"RefCounted"});
+}
+
 TEST(ClassTranslatorTest, LabelsOnRelations)
 {
     // Arrange
@@ -0,0 +1,212 @@
+#include "gtest/gtest.h"
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Class/WireFormat.h"
+
+namespace Cpp::Class {
+
+namespace {
+
+Class point()
+{
+    Class c;
+    c.name       = "Point";
+    c.namespaces = {"geo"};
+    c.isStruct   = true;
+    c.body.emplace_back(Variable{"x", Common::Type{"std::int32_t"}});
+    c.body.emplace_back(Variable{"kind", Common::Type{"Kind"}});
+    return c;
+}
+
+std::vector<Enum::Enum> kind()
+{
+    std::vector<Enum::Enum> enums(1);
+    enums[0].name       = "Kind";
+    enums[0].namespaces = {"geo"};
+    return enums;
+}
+
+} // namespace
+
+TEST(WireFormatTest, DisabledByDefault)
+{
+    // Arrange
+    WireFormat sut{std::make_shared<Config>(), std::make_shared<Common::TypeRenderer>()};
+    std::vector<Class> classes{point()};
+
+    // Act
+    sut.select(classes, kind());
+
+    // Assert
+    EXPECT_FALSE(classes[0].hasWireFormat);
+}
+
+TEST(WireFormatTest, ScalarsEnumsStringsAndVectors)
+{
+    // Arrange
+    WireFormat sut{configWithArguments({"--wireFormat"}), std::make_shared<Common::TypeRenderer>()};
+
+    std::vector<Class> classes(1);
+    classes[0].name     = "Sample";
+    classes[0].isStruct = true;
+    classes[0].body.emplace_back(Method{"valid", Common::Type{"bool"}});
+    classes[0].body.emplace_back(Variable{"count", Common::Type{"int"}, "", false, true});
+    classes[0].body.emplace_back(Variable{"id", Common::Type{"std::uint64_t"}});
+    classes[0].body.emplace_back(Variable{"name", Common::Type{"std::string"}});
+    classes[0].body.emplace_back(Variable{"values", Common::Type{"std::vector", {Common::Type{"float"}}}});
+
+    // Act
+    sut.select(classes, {});
+    auto file = sut.generate(classes[0]);
+
+    // Assert
+    ASSERT_TRUE(classes[0].hasWireFormat);
+    EXPECT_EQ(file.path.filename(), "SampleWire.h");
+    EXPECT_EQ(file.content,
+              "#pragma once\n\n"
+              "#include \"Sample.h\"\n"
+              "#include \"PlantUML2Cpp/Wire.h\"\n\n"
+              "// Sample as read from the wire format, strings and vectors refer to the buffer\n"
+              "struct SampleView\n{\n"
+              "    Wire::View<std::uint64_t> id;\n"
+              "    Wire::View<std::string> name;\n"
+              "    Wire::View<std::vector<float>> values;\n"
+              "};\n\n"
+              "inline void wireWrite(Wire::Writer& out, const Sample& in) noexcept\n{\n"
+              "    Wire::put(out, in.id);\n"
+              "    Wire::put(out, in.name);\n"
+              "    Wire::put(out, in.values);\n"
+              "}\n\n"
+              "inline SampleView wireRead(Wire::Reader& in, Wire::Tag<Sample>) noexcept\n{\n"
+              "    SampleView out;\n"
+              "    out.id = Wire::get<std::uint64_t>(in);\n"
+              "    out.name = Wire::get<std::string>(in);\n"
+              "    out.values = Wire::get<std::vector<float>>(in);\n"
+              "    return out;\n}\n");
+}
+
+TEST(WireFormatTest, NestedStructs)
+{
+    // Arrange
+    WireFormat sut{configWithArguments({"--wireFormat"}), std::make_shared<Common::TypeRenderer>()};
+
+    std::vector<Class> classes(2);
+    classes[0].name       = "Path";
+    classes[0].namespaces = {"geo", "route"};
+    classes[0].isStruct   = true;
+    classes[0].body.emplace_back(Variable{"start", Common::Type{"geo::Point"}});
+    classes[0].body.emplace_back(Variable{"kinds", Common::Type{"std::vector", {Common::Type{"Kind"}}}});
+    classes[1] = point();
+
+    // Act
+    sut.select(classes, kind());
+    auto file = sut.generate(classes[0]);
+
+    // Assert
+    EXPECT_TRUE(classes[0].hasWireFormat);
+    EXPECT_TRUE(classes[1].hasWireFormat);
+    EXPECT_EQ(classes[0].wireIncludes, (std::set<std::string>{"geo/PointWire.h"}));
+    EXPECT_EQ(file.path.filename(), "PathWire.h");
+    EXPECT_EQ(file.path.parent_path().filename(), "route");
+    EXPECT_NE(file.content.find("#include \"geo/route/Path.h\"\n"), std::string::npos);
+    EXPECT_NE(file.content.find("#include \"geo/PointWire.h\"\n"), std::string::npos);
+    EXPECT_NE(file.content.find("out.start = Wire::get<geo::Point>(in);\n"), std::string::npos);
+}
+
+TEST(WireFormatTest, StructsAndEnumsOfOtherModels)
+{
+    // Arrange
+    WireFormat sut{configWithArguments({"--wireFormat", "--headerExt", "hpp"}),
+                   std::make_shared<Common::TypeRenderer>()};
+
+    std::vector<Class> project(1, point());
+    sut.index(project, kind());
+
+    std::vector<Class> classes(1);
+    classes[0].name       = "Path";
+    classes[0].namespaces = {"geo", "route"};
+    classes[0].isStruct   = true;
+    classes[0].body.emplace_back(Variable{"start", Common::Type{"Point"}});
+    classes[0].body.emplace_back(Variable{"kinds", Common::Type{"std::vector", {Common::Type{"Kind"}}}});
+
+    // Act
+    sut.select(classes, {});
+
+    // Assert
+    EXPECT_TRUE(classes[0].hasWireFormat);
+    EXPECT_EQ(classes[0].wireIncludes, (std::set<std::string>{"geo/PointWire.hpp"}));
+}
+
+TEST(WireFormatTest, UnsupportedMembers)
+{
+    // Arrange
+    WireFormat sut{configWithArguments({"--wireFormat"}), std::make_shared<Common::TypeRenderer>()};
+
+    std::vector<Class> classes(5, point());
+    classes[0].name = "WithMap";
+    classes[0].body.emplace_back(
+        Variable{"index", Common::Type{"std::map", {Common::Type{"int"}, Common::Type{"int"}}}});
+    classes[1].name = "WithPointer";
+    classes[1].body.emplace_back(Variable{"next", Common::Type{"WithPointer*"}});
+    classes[2].name = "ContainsUnsupported";
+    classes[2].body.emplace_back(Variable{"map", Common::Type{"WithMap"}});
+    classes[3].name = "WithVectorOfStructs";
+    classes[3].body.emplace_back(Variable{"points", Common::Type{"std::vector", {Common::Type{"Point"}}}});
+    classes[4].name = "WithVectorOfBools";
+    classes[4].body.emplace_back(Variable{"flags", Common::Type{"std::vector", {Common::Type{"bool"}}}});
+
+    // Act
+    sut.select(classes, kind());
+
+    // Assert
+    for (const auto& c : classes) {
+        EXPECT_FALSE(c.hasWireFormat) << c.name;
+    }
+}
+
+TEST(WireFormatTest, OnlyFixedWidthScalars)
+{
+    // Arrange
+    WireFormat sut{configWithArguments({"--wireFormat"}), std::make_shared<Common::TypeRenderer>()};
+
+    std::vector<Class> classes(3, point());
+    classes[0].name = "WithInt";
+    classes[0].body.emplace_back(Variable{"count", Common::Type{"int"}});
+    classes[1].name = "WithSize";
+    classes[1].body.emplace_back(Variable{"size", Common::Type{"std::size_t"}});
+    classes[2].name = "WithFixedWidth";
+    classes[2].body.emplace_back(Variable{"size", Common::Type{"std::uint64_t"}});
+    classes[2].body.emplace_back(Variable{"scale", Common::Type{"double"}});
+
+    // Act
+    sut.select(classes, kind());
+
+    // Assert
+    EXPECT_FALSE(classes[0].hasWireFormat);
+    EXPECT_FALSE(classes[1].hasWireFormat);
+    EXPECT_TRUE(classes[2].hasWireFormat);
+}
+
+TEST(WireFormatTest, OnlyStructsWithPublicData)
+{
+    // Arrange
+    WireFormat sut{configWithArguments({"--wireFormat"}), std::make_shared<Common::TypeRenderer>()};
+
+    std::vector<Class> classes(3, point());
+    classes[0].name     = "Class";
+    classes[0].isStruct = false;
+    classes[1].name     = "Private";
+    classes[1].body.insert(classes[1].body.begin(), VisibilityKeyword{"private:"});
+    classes[2].name = "Empty";
+    classes[2].body.clear();
+
+    // Act
+    sut.select(classes, kind());
+
+    // Assert
+    for (const auto& c : classes) {
+        EXPECT_FALSE(c.hasWireFormat) << c.name;
+    }
+}
+
+} // namespace Cpp::Class
@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Common/CodeGeneratorUtils.h"
+
+namespace Cpp::Common {
+
+namespace {
+
+std::string block(CodeGeneratorUtils& sut, const std::list<std::string>& namespaces)
+{
+    CodeEmitter out;
+    sut.openNamespaces(out, namespaces);
+    out << "body\n";
+    sut.closeNamespaces(out, namespaces);
+    return out.str();
+}
+
+} // namespace
+
+TEST(CodeGeneratorUtilsTest, NestedAndEmptyNamespaces)
+{
+    // Arrange
+    CodeGeneratorUtils sut(std::make_shared<Config>());
+
+    // Act
+    auto outer  = block(sut, {"outer"});
+    auto inner  = block(sut, {"outer", "inner"});
+    auto global = block(sut, {});
+    auto cached = block(sut, {"outer"});
+
+    // Assert
+    EXPECT_EQ(outer, "namespace outer {\nbody\n} // namespace outer\n");
+    EXPECT_EQ(inner,
+              "namespace outer {\nnamespace inner {\nbody\n} // namespace inner\n} // namespace outer\n");
+    EXPECT_EQ(global, "body\n");
+    EXPECT_EQ(cached, outer);
+}
+
+TEST(CodeGeneratorUtilsTest, ConcatenatedNamespaces)
+{
+    // Arrange
+    CodeGeneratorUtils sut(configWithArguments({"-n"}));
+
+    // Act
+    auto inner  = block(sut, {"outer", "inner"});
+    auto outer  = block(sut, {"outer"});
+    auto global = block(sut, {});
+
+    // Assert
+    EXPECT_EQ(inner, "namespace outer::inner {\nbody\n} // namespace outer::inner\n");
+    EXPECT_EQ(outer, "namespace outer {\nbody\n} // namespace outer\n");
+    EXPECT_EQ(global, "body\n");
+}
+
+TEST(CodeGeneratorUtilsTest, ConcurrentLookups)
+{
+    // Arrange
+    CodeGeneratorUtils sut(std::make_shared<Config>());
+    std::vector<std::list<std::string>> paths{{}, {"a"}, {"a", "b"}, {"a", "b", "c"}, {"b"}};
+    std::vector<std::vector<std::string>> results(4);
+
+    // Act
+    {
+        std::vector<std::jthread> threads;
+        for (auto& result : results) {
+            threads.emplace_back([&sut, &paths, &result]() {
+                for (int i = 0; i < 100; ++i) {
+                    for (const auto& path : paths) {
+                        result.push_back(block(sut, path));
+                    }
+                }
+            });
+        }
+    }
+
+    // Assert
+    for (const auto& result : results) {
+        EXPECT_EQ(result, results.front());
+    }
+    EXPECT_EQ(results.front()[3],
+              "namespace a {\nnamespace b {\nnamespace c {\n"
+              "body\n"
+              "} // namespace c\n} // namespace b\n} // namespace a\n");
+}
+
+} // namespace Cpp::Common
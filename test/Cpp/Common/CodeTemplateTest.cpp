@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "Cpp/Common/CodeTemplate.h"
+
+namespace Cpp::Common {
+
+namespace {
+
+const std::vector<std::string_view> placeholders = {"name", "body"};
+
+std::string render(const CodeTemplate& sut)
+{
+    CodeEmitter out;
+    sut.render(out, [](CodeEmitter& o, size_t placeholder) { o << (placeholder == 0 ? "Foo" : "int a;"); });
+    return out.str();
+}
+
+} // namespace
+
+TEST(CodeTemplateTest, PlaceholdersAreReplaced)
+{
+    // Arrange
+    CodeTemplate sut("struct {{name}}\n{\n    {{body}}\n};\n", placeholders);
+
+    // Act
+    auto output = render(sut);
+
+    // Assert
+    EXPECT_EQ(output, "struct Foo\n{\n    int a;\n};\n");
+}
+
+TEST(CodeTemplateTest, PlaceholderUsedTwice)
+{
+    // Arrange
+    CodeTemplate sut("{{name}}::{{name}}", placeholders);
+
+    // Act
+    auto output = render(sut);
+
+    // Assert
+    EXPECT_EQ(output, "Foo::Foo");
+}
+
+TEST(CodeTemplateTest, UnknownPlaceholderIsKeptAsText)
+{
+    // Arrange
+    CodeTemplate sut("{{name}} {{unknown}} {{body", placeholders);
+
+    // Act
+    auto output = render(sut);
+
+    // Assert
+    EXPECT_EQ(output, "Foo {{unknown}} {{body");
+    EXPECT_EQ(sut.literalSize(), std::string(" {{unknown}} {{body").size());
+}
+
+TEST(CodeTemplateTest, ContainsPlaceholder)
+{
+    // Arrange
+    CodeTemplate sut("class {{name}} {{unknown}};", placeholders);
+
+    // Act
+    bool name = sut.contains(0);
+    bool body = sut.contains(1);
+
+    // Assert
+    EXPECT_TRUE(name);
+    EXPECT_FALSE(body);
+}
+
+TEST(CodeTemplateTest, MissingFileUsesFallback)
+{
+    // Arrange
+    auto sut = CodeTemplate::fromFile("", "class {{name}};", placeholders);
+
+    // Act
+    auto output = render(sut);
+
+    // Assert
+    EXPECT_EQ(output, "class Foo;");
+}
+
+} // namespace Cpp::Common
@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+
+#include "Cpp/Common/ModelIndex.h"
+
+namespace Cpp::Common {
+
+TEST(ModelIndexTest, InnermostNamespaceFirst)
+{
+    // Arrange
+    ModelIndex<int> sut;
+    sut.add({}, "Point", 0);
+    sut.add({"geo"}, "Point", 1);
+    sut.add({"geo", "detail"}, "Line", 2);
+
+    // Act
+    const auto* inner  = sut.find({"geo", "detail"}, "Point");
+    const auto* global = sut.find({"geo", "detail"}, "::Point");
+    const auto* other  = sut.find({"net"}, "Point");
+    const auto* nested = sut.find({"geo"}, "detail::Line");
+
+    // Assert
+    ASSERT_NE(inner, nullptr);
+    EXPECT_EQ(*inner, 1);
+    ASSERT_NE(global, nullptr);
+    EXPECT_EQ(*global, 0);
+    ASSERT_NE(other, nullptr);
+    EXPECT_EQ(*other, 0);
+    ASSERT_NE(nested, nullptr);
+    EXPECT_EQ(*nested, 2);
+}
+
+TEST(ModelIndexTest, UnknownAndInnerTypesAreNotFound)
+{
+    // Arrange
+    ModelIndex<int> sut;
+    sut.add({"geo"}, "Point", 0);
+
+    // Act
+    const auto* unknown = sut.find({"geo"}, "Line");
+    const auto* inner   = sut.find({}, "Point");
+    const auto* global  = sut.find({"geo"}, "::Point");
+
+    // Assert
+    EXPECT_EQ(unknown, nullptr);
+    EXPECT_EQ(inner, nullptr);
+    EXPECT_EQ(global, nullptr);
+}
+
+TEST(ModelIndexTest, FirstTypeWins)
+{
+    // Arrange
+    ModelIndex<int> sut;
+    sut.add({"geo"}, "Point", 0);
+    sut.add({"geo"}, "Point", 1);
+
+    // Act
+    const auto* found = sut.find({}, "geo::Point");
+
+    // Assert
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(*found, 0);
+}
+
+TEST(ModelIndexTest, AtDoesNotLookOutwards)
+{
+    // Arrange
+    ModelIndex<int> sut;
+    sut.add({}, "Point", 0);
+    sut.add({"geo"}, "Line", 1);
+
+    // Act
+    const auto* exact = sut.at({"geo"}, "Line");
+    const auto* outer = sut.at({"geo"}, "Point");
+
+    // Assert
+    ASSERT_NE(exact, nullptr);
+    EXPECT_EQ(*exact, 1);
+    EXPECT_EQ(outer, nullptr);
+}
+
+TEST(ModelIndexTest, QualifiedName)
+{
+    EXPECT_EQ(qualifiedName({}, "Point"), "Point");
+    EXPECT_EQ(qualifiedName({"geo", "detail"}, "Point"), "geo::detail::Point");
+}
+
+} // namespace Cpp::Common
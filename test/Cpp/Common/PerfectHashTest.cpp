@@ -0,0 +1,59 @@
+#include "gtest/gtest.h"
+
+#include <set>
+#include <string>
+
+#include "Cpp/Common/PerfectHash.h"
+
+namespace Cpp::Common {
+
+TEST(PerfectHashTest, NoCollisions)
+{
+    // Arrange
+    std::vector<std::string> names;
+    for (int i = 0; i < 100; ++i) {
+        names.push_back("Enumerator" + std::to_string(i));
+    }
+    std::vector<std::string_view> keys(names.begin(), names.end());
+
+    // Act
+    auto hash = PerfectHash::build(keys);
+
+    // Assert
+    ASSERT_TRUE(hash.has_value());
+    EXPECT_EQ(hash->seeds.size(), size_t(1) << (32 - hash->bucketShift));
+    EXPECT_EQ(hash->slots.size(), size_t(1) << (32 - hash->slotShift));
+    EXPECT_LE(hash->slots.size(), 4 * keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(hash->find(keys[i]), i + 1);
+    }
+}
+
+TEST(PerfectHashTest, SingleKey)
+{
+    // Act
+    auto hash = PerfectHash::build({"Red"});
+
+    // Assert
+    ASSERT_TRUE(hash.has_value());
+    EXPECT_EQ(hash->find("Red"), 1);
+}
+
+TEST(PerfectHashTest, SeededHash)
+{
+    // Act & Assert
+    EXPECT_EQ(PerfectHash::hash("Red", 0), PerfectHash::hash("Red", 0));
+    EXPECT_NE(PerfectHash::hash("Red", 1), PerfectHash::hash("Red", 0));
+    EXPECT_NE(PerfectHash::hash("Enumerator1", 0) >> 28, PerfectHash::hash("Enumerator2", 0) >> 28);
+}
+
+TEST(PerfectHashTest, DuplicateKeys)
+{
+    // Act
+    auto hash = PerfectHash::build({"Red", "Green", "Red"});
+
+    // Assert
+    EXPECT_FALSE(hash.has_value());
+}
+
+} // namespace Cpp::Common
@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+
+#include "Common/CapturedOutput.h"
+#include "Common/ConfigHelper.h"
+#include "Cpp/Common/TranslatorUtils.h"
+
+namespace Cpp::Common {
+
+TEST(TranslatorUtilsTest, StringToCppTypeIgnoresWhitespace)
+{
+    // Arrange
+    TranslatorUtils sut{std::make_shared<Config>()};
+
+    // Act
+    auto type = sut.stringToCppType("std::pair< int , Element >");
+
+    // Assert
+    EXPECT_EQ(type, (Type{"std::pair", {{"int"}, {"Element"}}}));
+}
+
+TEST(TranslatorUtilsTest, CompositionFromConfiguredContainer)
+{
+    // Arrange
+    TranslatorUtils sut{std::make_shared<Config>()};
+
+    // Act
+    auto type = sut.compositionType("0..*", "Element");
+
+    // Assert
+    EXPECT_EQ(type, (Type{"std::vector", {{"Element"}}}));
+}
+
+TEST(TranslatorUtilsTest, CompositionFromBounds)
+{
+    // Arrange
+    TranslatorUtils sut{std::make_shared<Config>()};
+
+    // Act & Assert
+    EXPECT_EQ(sut.compositionType("", "Element"), Type{"Element"});
+    EXPECT_EQ(sut.compositionType("1", "Element"), Type{"Element"});
+    EXPECT_EQ(sut.compositionType("many", "Element"), Type{"Element"});
+    EXPECT_EQ(sut.compositionType("0..1", "Element"), (Type{"std::optional", {{"Element"}}}));
+    EXPECT_EQ(sut.compositionType("4", "Element"), (Type{"std::array", {{"Element"}, {"4"}}}));
+    EXPECT_EQ(sut.compositionType("2..2", "Element"), (Type{"std::array", {{"Element"}, {"2"}}}));
+    EXPECT_EQ(sut.compositionType("0..8", "Element"), (Type{"std::vector", {{"Element"}}}));
+    EXPECT_EQ(sut.compositionType("1..100", "Element"), (Type{"std::vector", {{"Element"}}}));
+    EXPECT_EQ(sut.compositionType("*", "Element"), (Type{"std::vector", {{"Element"}}}));
+    EXPECT_EQ(sut.compositionType("1..*", "Element"), (Type{"std::vector", {{"Element"}}}));
+}
+
+TEST(TranslatorUtilsTest, CompositionWithOtherBoundedContainer)
+{
+    // Arrange
+    TranslatorUtils sut{configWithArguments({"--boundedContainer", "SmallVector<{}, {}>", "--maxInlineCapacity", "4"})};
+
+    // Act & Assert
+    EXPECT_EQ(sut.compositionType("0..4", "Element"), (Type{"SmallVector", {{"Element"}, {"4"}}}));
+    EXPECT_EQ(sut.compositionType("0..5", "Element"), (Type{"std::vector", {{"Element"}}}));
+}
+
+TEST(TranslatorUtilsTest, SharedAggregationFromConfiguredContainer)
+{
+    // Arrange
+    TranslatorUtils sut{std::make_shared<Config>()};
+
+    // Act & Assert
+    EXPECT_EQ(sut.aggregationType("1", "Element", "shared"), (Type{"std::shared_ptr", {{"Element"}}}));
+    EXPECT_EQ(sut.aggregationType("0..*", "Element", "shared"),
+              (Type{"std::vector", {{"std::shared_ptr", {{"Element"}}}}}));
+}
+
+TEST(TranslatorUtilsTest, UnknownAggregationPolicyWarnsOnce)
+{
+    // Arrange
+    TranslatorUtils sut{std::make_shared<Config>()};
+    CapturedOutput out;
+
+    // Act
+    auto first  = sut.aggregationType("1", "Element", "unknown");
+    auto second = sut.aggregationType("0..*", "Element", "unknown");
+
+    // Assert
+    EXPECT_EQ(first, (Type{"std::shared_ptr", {{"Element"}}}));
+    EXPECT_EQ(second, (Type{"std::vector", {{"std::shared_ptr", {{"Element"}}}}}));
+    EXPECT_EQ(out.str(), "WARNING! Unknown aggregation policy unknown, using shared\n");
+}
+
+TEST(TranslatorUtilsTest, AggregationPolicies)
+{
+    // Arrange
+    TranslatorUtils sut{std::make_shared<Config>()};
+
+    // Act & Assert
+    EXPECT_EQ(sut.aggregationType("", "Element", "observer"), Type{"Element*"});
+    EXPECT_EQ(sut.aggregationType("0..1", "Element", "weak"), (Type{"std::weak_ptr", {{"Element"}}}));
+    EXPECT_EQ(sut.aggregationType("1", "ns::Element", "intrusive"), (Type{"IntrusivePtr", {{"ns::Element"}}}));
+    EXPECT_EQ(sut.aggregationType("0..*", "Element", "pool"), (Type{"std::vector", {{"Handle", {{"Element"}}}}}));
+    EXPECT_EQ(sut.aggregationType("2..4", "Element", "observer"), (Type{"std::vector", {{"Element*"}}}));
+}
+
+} // namespace Cpp::Common
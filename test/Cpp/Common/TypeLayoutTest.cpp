@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "Cpp/Common/TypeLayout.h"
+
+namespace Cpp::Common {
+
+TEST(TypeLayoutTest, FundamentalsAndPointers)
+{
+    // Arrange
+    TypeLayout sut(std::make_shared<Config>());
+
+    // Act
+    auto integer = sut.layoutOf(Type{"int"});
+    auto pointer = sut.layoutOf(Type{"Foo*"});
+    auto unknown = sut.layoutOf(Type{"Foo"});
+
+    // Assert
+    ASSERT_TRUE(integer.has_value());
+    EXPECT_EQ(integer->size, 4);
+    EXPECT_EQ(integer->alignment, 4);
+    ASSERT_TRUE(pointer.has_value());
+    EXPECT_EQ(pointer->size, 8);
+    EXPECT_FALSE(unknown.has_value());
+}
+
+TEST(TypeLayoutTest, TemplatesDependingOnParameters)
+{
+    // Arrange
+    TypeLayout sut(std::make_shared<Config>());
+
+    // Act
+    auto optional = sut.layoutOf(Type{"std::optional", {Type{"double"}}});
+    auto pair     = sut.layoutOf(Type{"std::pair", {Type{"bool"}, Type{"int"}}});
+    auto array    = sut.layoutOf(Type{"std::array", {Type{"short"}, Type{"5"}}});
+
+    // Assert
+    ASSERT_TRUE(optional.has_value());
+    EXPECT_EQ(optional->size, 16);
+    ASSERT_TRUE(pair.has_value());
+    EXPECT_EQ(pair->size, 8);
+    ASSERT_TRUE(array.has_value());
+    EXPECT_EQ(array->size, 10);
+    EXPECT_EQ(array->alignment, 2);
+}
+
+TEST(TypeLayoutTest, UnknownTypesAreResolved)
+{
+    // Arrange
+    TypeLayout sut(std::make_shared<Config>());
+    auto resolve = [](const std::string& type) -> std::optional<Layout> {
+        return type == "Foo" ? std::optional(Layout{12, 4}) : std::nullopt;
+    };
+
+    // Act
+    auto output = sut.layoutOf(Type{"std::optional", {Type{"Foo"}}}, resolve);
+
+    // Assert
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(output->size, 16);
+    EXPECT_EQ(output->alignment, 4);
+}
+
+TEST(TypeLayoutTest, StructPadding)
+{
+    // Arrange
+    std::vector<Layout> members{{1, 1}, {8, 8}, {2, 2}};
+
+    // Act
+    auto output = TypeLayout::structLayout(members);
+
+    // Assert
+    EXPECT_EQ(output.size, 24);
+    EXPECT_EQ(output.alignment, 8);
+}
+
+} // namespace Cpp::Common
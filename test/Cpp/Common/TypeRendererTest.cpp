@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+#include "Cpp/Common/TypeRenderer.h"
+
+namespace Cpp::Common {
+
+TEST(TypeRendererTest, SimpleType)
+{
+    // Arrange
+    TypeRenderer sut;
+
+    // Act
+    auto output = sut.render(Type{"int"});
+
+    // Assert
+    EXPECT_EQ(output, "int");
+}
+
+TEST(TypeRendererTest, NestedTemplates)
+{
+    // Arrange
+    TypeRenderer sut;
+    Type type{"std::unordered_map",
+              {Type{"std::string"}, Type{"std::vector", {Type{"std::shared_ptr", {Type{"ns::Foo"}}}}}}};
+
+    // Act
+    auto output = sut.render(type);
+
+    // Assert
+    EXPECT_EQ(output, "std::unordered_map<std::string, std::vector<std::shared_ptr<ns::Foo>>>");
+}
+
+TEST(TypeRendererTest, RepeatedTypesShareSpelling)
+{
+    // Arrange
+    TypeRenderer sut;
+    Type type{"std::vector", {Type{"std::shared_ptr", {Type{"Foo"}}}}};
+
+    // Act
+    auto first  = sut.render(type);
+    auto other  = sut.render(Type{"std::vector", {Type{"std::shared_ptr", {Type{"Bar"}}}}});
+    auto second = sut.render(Type{"std::vector", {Type{"std::shared_ptr", {Type{"Foo"}}}}});
+
+    // Assert
+    EXPECT_EQ(first, "std::vector<std::shared_ptr<Foo>>");
+    EXPECT_EQ(other, "std::vector<std::shared_ptr<Bar>>");
+    EXPECT_EQ(first.data(), second.data());
+}
+
+TEST(TypeRendererTest, ManyTemplateParameters)
+{
+    // Arrange
+    TypeRenderer sut;
+    Type type{"std::tuple"};
+    for (int i = 0; i < 10; ++i) {
+        type.templateParams.push_back(Type{"T" + std::to_string(i)});
+    }
+
+    // Act
+    auto output = sut.render(type);
+
+    // Assert
+    EXPECT_EQ(output, "std::tuple<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9>");
+}
+
+TEST(TypeRendererTest, ConcurrentRenderingSharesSpelling)
+{
+    // Arrange
+    TypeRenderer sut;
+    std::vector<std::string_view> outputs(8);
+
+    // Act
+    {
+        std::vector<std::jthread> threads;
+        for (size_t t = 0; t < outputs.size(); ++t) {
+            threads.emplace_back([&sut, &outputs, t]() {
+                for (int i = 0; i < 100; ++i) {
+                    sut.render(Type{"std::vector", {Type{"T" + std::to_string(i)}}});
+                }
+                outputs[t] = sut.render(Type{"std::map", {Type{"int"}, Type{"Foo"}}});
+            });
+        }
+    }
+
+    // Assert
+    for (auto output : outputs) {
+        EXPECT_EQ(output, "std::map<int, Foo>");
+        EXPECT_EQ(output.data(), outputs.front().data());
+    }
+}
+
+} // namespace Cpp::Common
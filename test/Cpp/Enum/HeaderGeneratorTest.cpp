@@ -2,6 +2,7 @@
 
 #include <regex>
 
+#include "Common/ConfigHelper.h"
 #include "Config.h"
 #include "Cpp/Enum/Enum.h"
 #include "Cpp/Enum/HeaderGenerator.h"
@@ -70,4 +71,148 @@ TEST(EnumHeaderGenerator, MultipleEnumerators)
     EXPECT_TRUE(std::regex_match(output, classRegex)) << output;
 }
 
+TEST(EnumHeaderGenerator, Reflection)
+{
+    // Arrange
+    HeaderGenerator sut(configWithArguments({"--enumReflection"}));
+
+    Enum input;
+    input.name = "Color";
+    input.enumerators.push_back(Enumerator{"Red"});
+    input.enumerators.push_back(Enumerator{"Green"});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_NE(output.find("#include <string_view>\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("constexpr std::size_t ColorCount = 2;\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("constexpr std::array<std::string_view, ColorCount> ColorNames = {\"Red\", \"Green\"};\n"),
+              std::string::npos)
+        << output;
+    EXPECT_NE(output.find("constexpr std::array<Color, ColorCount> ColorValues = {Color::Red, Color::Green};\n"),
+              std::string::npos)
+        << output;
+    EXPECT_NE(output.find("constexpr std::string_view toString(Color value)\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("constexpr std::optional<Color> ColorFromString(std::string_view name)\n"), std::string::npos)
+        << output;
+}
+
+TEST(EnumHeaderGenerator, ReflectionWithoutPerfectHash)
+{
+    // Arrange
+    HeaderGenerator sut(configWithArguments({"--enumReflection"}));
+
+    Enum input;
+    input.name = "Color";
+    input.enumerators.push_back(Enumerator{"Red"});
+    input.enumerators.push_back(Enumerator{"Red"});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_NE(output.find("constexpr std::optional<Color> ColorFromString(std::string_view name)\n"
+                          "{\n"
+                          "    for (std::size_t i = 0; i < ColorCount; ++i) {\n"
+                          "        if (ColorNames[i] == name) {\n"
+                          "            return ColorValues[i];\n"
+                          "        }\n"
+                          "    }\n"
+                          "    return std::nullopt;\n"
+                          "}\n"),
+              std::string::npos)
+        << output;
+    EXPECT_EQ(output.find("seeds"), std::string::npos) << output;
+}
+
+TEST(EnumHeaderGenerator, NoReflectionByDefault)
+{
+    // Arrange
+    HeaderGenerator sut(std::make_shared<Config>());
+
+    Enum input;
+    input.name = "Color";
+    input.enumerators.push_back(Enumerator{"Red"});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_EQ(output, "#pragma once\n\nenum class Color{\n    Red\n};");
+}
+
+TEST(EnumHeaderGenerator, UnderlyingTypeAndValues)
+{
+    // Arrange
+    HeaderGenerator sut(std::make_shared<Config>());
+
+    Enum input;
+    input.name           = "Level";
+    input.underlyingType = "std::int8_t";
+    input.enumerators.push_back(Enumerator{"Low", -1});
+    input.enumerators.push_back(Enumerator{"High"});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_EQ(output,
+              "#pragma once\n\n#include <cstdint>\n\nenum class Level : std::int8_t{\n    Low = -1,\n    High\n};");
+}
+
+TEST(EnumHeaderGenerator, ReflectionOfSparseValues)
+{
+    // Arrange
+    HeaderGenerator sut(configWithArguments({"--enumReflection"}));
+
+    Enum input;
+    input.name = "Level";
+    input.enumerators.push_back(Enumerator{"Low", 1});
+    input.enumerators.push_back(Enumerator{"Minimum", 1});
+    input.enumerators.push_back(Enumerator{"High", 10});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_NE(output.find("    switch (value) {\n"
+                          "    case Level::Low:\n"
+                          "        return LevelNames[0];\n"
+                          "    case Level::High:\n"
+                          "        return LevelNames[2];\n"
+                          "    }\n"),
+              std::string::npos)
+        << output;
+}
+
+TEST(EnumHeaderGenerator, FlagOperators)
+{
+    // Arrange
+    HeaderGenerator sut(std::make_shared<Config>());
+
+    Enum input;
+    input.name           = "Permissions";
+    input.stereotype     = "Flags";
+    input.underlyingType = "std::uint8_t";
+    input.enumerators.push_back(Enumerator{"Read", 1});
+    input.enumerators.push_back(Enumerator{"Write", 2});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_NE(output.find("#include <type_traits>\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("constexpr Permissions operator|(Permissions lhs, Permissions rhs)\n"), std::string::npos)
+        << output;
+    EXPECT_NE(output.find("constexpr Permissions& operator^=(Permissions& lhs, Permissions rhs)\n"), std::string::npos)
+        << output;
+    EXPECT_NE(output.find("return static_cast<Permissions>(~static_cast<std::underlying_type_t<Permissions>>(value) "
+                          "& static_cast<std::underlying_type_t<Permissions>>(0x3u));"),
+              std::string::npos)
+        << output;
+    EXPECT_NE(output.find("constexpr bool hasFlag(Permissions value, Permissions flag)\n"), std::string::npos)
+        << output;
+}
+
 } // namespace Cpp::Enum
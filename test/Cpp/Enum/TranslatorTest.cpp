@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 
+#include "Common/CapturedOutput.h"
+#include "Common/ConfigHelper.h"
 #include "Cpp/Enum/Translator.h"
 #include "PlantUml/ModelElement.h"
 #include "PlantUml/Parser.h"
@@ -76,4 +78,144 @@ TEST(EnumTranslatorTest, EnumWithContent)
     EXPECT_EQ(enums[0].enumerators[1].name, "Type2");
 }
 
+TEST(EnumTranslatorTest, EnumeratorValues)
+{
+    // Arrange
+    Translator sut{std::make_shared<Config>()};
+
+    puml::Container c{{}, "", puml::ContainerType::Document};
+    puml::Element e{{"Enum"}};
+    e.type = puml::ElementType::Enum;
+    puml::Enumerator t1{"Type1", "-5"};
+    puml::Enumerator t2{"Type2"};
+    puml::End ee{puml::EndType::Element};
+    puml::End ec{puml::EndType::Document};
+
+    // Act
+    sut.visit(c);
+    sut.visit(e);
+    sut.visit(t1);
+    sut.visit(t2);
+    sut.visit(ee);
+    sut.visit(ec);
+
+    // Assert
+    auto enums = std::move(sut).results();
+    ASSERT_EQ(enums.size(), 1);
+    ASSERT_EQ(enums[0].enumerators.size(), 2);
+    EXPECT_EQ(enums[0].enumerators[0].value, -5);
+    EXPECT_FALSE(enums[0].enumerators[1].value.has_value());
+    EXPECT_EQ(values(enums[0]), (std::vector<std::int64_t>{-5, -4}));
+    EXPECT_TRUE(enums[0].underlyingType.empty());
+}
+
+TEST(EnumTranslatorTest, SmallestUnderlyingType)
+{
+    // Arrange
+    Translator sut{configWithArguments({"--enumUnderlyingType", "auto"})};
+
+    puml::Container c{{}, "", puml::ContainerType::Document};
+    puml::Element small{{"Small"}};
+    small.type = puml::ElementType::Enum;
+    puml::Enumerator s1{"A"};
+    puml::Enumerator s2{"B"};
+    puml::Element wide{{"Wide"}};
+    wide.type = puml::ElementType::Enum;
+    puml::Enumerator w1{"A", "256"};
+    puml::Element negative{{"Negative"}};
+    negative.type = puml::ElementType::Enum;
+    puml::Enumerator n1{"A", "-129"};
+    puml::End ee{puml::EndType::Element};
+    puml::End ec{puml::EndType::Document};
+
+    // Act
+    sut.visit(c);
+    sut.visit(small);
+    sut.visit(s1);
+    sut.visit(s2);
+    sut.visit(ee);
+    sut.visit(wide);
+    sut.visit(w1);
+    sut.visit(ee);
+    sut.visit(negative);
+    sut.visit(n1);
+    sut.visit(ee);
+    sut.visit(ec);
+
+    // Assert
+    auto enums = std::move(sut).results();
+    ASSERT_EQ(enums.size(), 3);
+    EXPECT_EQ(enums[0].underlyingType, "std::uint8_t");
+    EXPECT_EQ(enums[1].underlyingType, "std::uint16_t");
+    EXPECT_EQ(enums[2].underlyingType, "std::int16_t");
+}
+
+TEST(EnumTranslatorTest, FlagsArePowersOfTwo)
+{
+    // Arrange
+    Translator sut{std::make_shared<Config>()};
+
+    puml::Container c{{}, "", puml::ContainerType::Document};
+    puml::Element e{{"Permissions"}, "Flags"};
+    e.type = puml::ElementType::Enum;
+    puml::Enumerator none{"None", "0"};
+    puml::Enumerator read{"Read"};
+    puml::Enumerator write{"Write"};
+    puml::Enumerator execute{"Execute", "8"};
+    puml::Enumerator remove{"Remove"};
+    puml::End ee{puml::EndType::Element};
+    puml::End ec{puml::EndType::Document};
+
+    // Act
+    sut.visit(c);
+    sut.visit(e);
+    sut.visit(none);
+    sut.visit(read);
+    sut.visit(write);
+    sut.visit(execute);
+    sut.visit(remove);
+    sut.visit(ee);
+    sut.visit(ec);
+
+    // Assert
+    auto enums = std::move(sut).results();
+    ASSERT_EQ(enums.size(), 1);
+    EXPECT_EQ(enums[0].stereotype, "Flags");
+    EXPECT_EQ(values(enums[0]), (std::vector<std::int64_t>{0, 1, 2, 8, 16}));
+    EXPECT_EQ(enums[0].underlyingType, "std::uint8_t");
+}
+
+TEST(EnumTranslatorTest, TooManyFlags)
+{
+    // Arrange
+    Translator sut{std::make_shared<Config>()};
+
+    puml::Container c{{}, "", puml::ContainerType::Document};
+    puml::Element e{{"Features"}, "Flags"};
+    e.type = puml::ElementType::Enum;
+    std::vector<puml::Enumerator> enumerators;
+    for (int i = 0; i < 64; ++i) {
+        enumerators.push_back(puml::Enumerator{"Feature" + std::to_string(i)});
+    }
+    puml::End ee{puml::EndType::Element};
+    puml::End ec{puml::EndType::Document};
+    CapturedOutput out;
+
+    // Act
+    sut.visit(c);
+    sut.visit(e);
+    for (const auto& enumerator : enumerators) {
+        sut.visit(enumerator);
+    }
+    sut.visit(ee);
+    sut.visit(ec);
+    auto enums = std::move(sut).results();
+
+    // Assert
+    ASSERT_EQ(enums.size(), 1);
+    EXPECT_EQ(enums[0].enumerators[62].value, std::int64_t(1) << 62);
+    EXPECT_FALSE(enums[0].enumerators[63].value);
+    EXPECT_EQ(out.str(), "ERROR! No bit left for flag Features::Feature63, flags have the bits 0 to 62\n");
+}
+
 } // namespace Cpp::Enum
@@ -2,6 +2,7 @@
 
 #include <regex>
 
+#include "Common/ConfigHelper.h"
 #include "Config.h"
 #include "Cpp/Variant/HeaderGenerator.h"
 #include "Cpp/Variant/Variant.h"
@@ -50,5 +51,122 @@ TEST(VariantHeaderGenerator, SingleType)
     EXPECT_TRUE(std::regex_match(output, classRegex)) << output;
 }
 
+TEST(VariantHeaderGenerator, TemplateAlternatives)
+{
+    // Arrange
+    auto config = std::make_shared<Config>();
+    HeaderGenerator sut(config);
+
+    Variant input;
+    input.name = "Shape";
+    input.containedTypes.push_back(Common::Type{"Point"});
+    input.containedTypes.push_back(Common::Type{"Polygon", {Common::Type{"Point"}, Common::Type{"8"}}});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_NE(output.find("using Shape = std::variant<Point, Polygon<Point, 8>>;"), std::string::npos) << output;
+}
+
+TEST(VariantHeaderGenerator, Dispatch)
+{
+    // Arrange
+    HeaderGenerator sut(configWithArguments({"--variantDispatch"}));
+
+    Variant input;
+    input.name = "Shape";
+    input.containedTypes.push_back(Common::Type{"Circle"});
+    input.containedTypes.push_back(Common::Type{"Square"});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_NE(output.find("enum class ShapeIndex : std::size_t\n{\n    Circle,\n    Square\n};\n"), std::string::npos)
+        << output;
+    EXPECT_NE(output.find("struct ShapeIndexOf<Square> : std::integral_constant<ShapeIndex, ShapeIndex::Square>\n"),
+              std::string::npos)
+        << output;
+    EXPECT_NE(output.find("constexpr ShapeIndex indexOf(const Shape& value)\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("constexpr decltype(auto) visitShape(F&& f, const Shape& value)\n"), std::string::npos)
+        << output;
+    EXPECT_NE(output.find("    case 1:\n        return std::forward<F>(f)(std::get<1>(value));\n"), std::string::npos)
+        << output;
+}
+
+TEST(VariantHeaderGenerator, RepeatedAlternatives)
+{
+    // Arrange
+    HeaderGenerator sut(configWithArguments({"--variantDispatch"}));
+
+    Variant input;
+    input.name = "Pair";
+    input.containedTypes.push_back(Common::Type{"Point"});
+    input.containedTypes.push_back(Common::Type{"Point"});
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_NE(output.find("    Point0,\n    Point1\n"), std::string::npos) << output;
+    EXPECT_EQ(output.find("struct PairIndexOf<Point>"), std::string::npos) << output;
+}
+
+TEST(VariantHeaderGenerator, TaggedUnion)
+{
+    // Arrange
+    HeaderGenerator sut(configWithArguments({"--variantDispatch"}));
+
+    Variant input;
+    input.name           = "Shape";
+    input.isTaggedUnion  = true;
+    input.estimatedSize  = 16;
+    input.containedTypes = {Common::Type{"Circle"}, Common::Type{"Square"}};
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_EQ(output.find("std::variant"), std::string::npos) << output;
+    EXPECT_EQ(output.find("ShapeIndex"), std::string::npos) << output;
+    EXPECT_NE(output.find("// tagged union of trivially copyable alternatives, estimated sizeof: 16 bytes\n"
+                          "class Shape\n{\npublic:\n    enum class Index : std::uint8_t\n"),
+              std::string::npos)
+        << output;
+    EXPECT_NE(output.find("    constexpr Shape(const Square& value)\n        : m_storageSquare(value)\n"), std::string::npos)
+        << output;
+    EXPECT_NE(output.find("    constexpr const Circle& circle() const\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("    constexpr void set(const Square& value)\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("        default:\n            return std::forward<F>(f)(m_storageSquare);\n"), std::string::npos)
+        << output;
+    EXPECT_NE(output.find("    union\n    {\n        Circle m_storageCircle;\n        Square m_storageSquare;\n    };\n"
+                          "    Index m_index = Index::Circle;\n};\n"),
+              std::string::npos)
+        << output;
+    EXPECT_NE(output.find("static_assert(std::is_trivially_copyable_v<Shape>);\n"), std::string::npos) << output;
+}
+
+TEST(VariantHeaderGenerator, TaggedUnionWithoutMemberPrefix)
+{
+    // Arrange
+    HeaderGenerator sut(configWithArguments({"-p", ""}));
+
+    Variant input;
+    input.name           = "Shape";
+    input.isTaggedUnion  = true;
+    input.containedTypes = {Common::Type{"Point"}, Common::Type{"Square"}};
+
+    // Act
+    auto output = sut.generate(input);
+
+    // Assert
+    EXPECT_NE(output.find("    constexpr const Point& point() const\n    {\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("        Point m_storagePoint;\n"), std::string::npos) << output;
+    EXPECT_NE(output.find("    constexpr Index index() const\n    {\n        return m_index;\n"), std::string::npos)
+        << output;
+    EXPECT_NE(output.find("    Index m_index = Index::Point;\n"), std::string::npos) << output;
+}
+
 } // namespace Variant
 } // namespace Cpp
@@ -0,0 +1,150 @@
+#include "gtest/gtest.h"
+
+#include "Common/ConfigHelper.h"
+#include "Cpp/Variant/TaggedUnions.h"
+
+namespace Cpp::Variant {
+
+namespace {
+
+// Circle and Square are trivially copyable, Label holds a string and Shape is polymorphic
+std::vector<Class::Class> model()
+{
+    std::vector<Class::Class> classes(5);
+    classes[0].name       = "Circle";
+    classes[0].namespaces = {"geo"};
+    classes[0].body.emplace_back(Class::Variable{"radius", Common::Type{"double"}});
+    classes[0].body.emplace_back(Class::Variable{"color", Common::Type{"Color"}});
+
+    classes[1].name       = "Square";
+    classes[1].namespaces = {"geo"};
+    classes[1].inherits   = {"Base"};
+    classes[1].body.emplace_back(Class::Variable{"corners", Common::Type{"std::array", {{"Point"}, {"4"}}}});
+
+    classes[2].name = "Point";
+    classes[2].body.emplace_back(Class::Variable{"x", Common::Type{"float"}});
+    classes[2].body.emplace_back(Class::Variable{"y", Common::Type{"float"}});
+
+    classes[3].name       = "Label";
+    classes[3].namespaces = {"geo"};
+    classes[3].body.emplace_back(Class::Variable{"text", Common::Type{"std::string"}});
+
+    classes[4].name       = "Base";
+    classes[4].namespaces = {"geo"};
+    classes[4].body.emplace_back(Class::Method{"draw", Common::Type{"void"}, "", true});
+    return classes;
+}
+
+} // namespace
+
+TEST(TaggedUnionsTest, DisabledByDefault)
+{
+    // Arrange
+    TaggedUnions sut{std::make_shared<Config>()};
+
+    std::vector<Variant> variants(1);
+    variants[0].name           = "Shape";
+    variants[0].namespaces     = {"geo"};
+    variants[0].containedTypes = {Common::Type{"Circle"}};
+
+    // Act
+    sut.select(variants, model(), {});
+
+    // Assert
+    EXPECT_FALSE(variants[0].isTaggedUnion);
+}
+
+TEST(TaggedUnionsTest, TriviallyCopyableAlternatives)
+{
+    // Arrange
+    TaggedUnions sut{configWithArguments({"--compactVariants"})};
+
+    auto classes = model();
+    classes[1].inherits.clear();
+
+    std::vector<Enum::Enum> enums(1);
+    enums[0].name           = "Color";
+    enums[0].namespaces     = {"geo"};
+    enums[0].underlyingType = "std::uint8_t";
+
+    std::vector<Variant> variants(1);
+    variants[0].name           = "Shape";
+    variants[0].namespaces     = {"geo"};
+    variants[0].containedTypes = {Common::Type{"Circle"}, Common::Type{"Square"}};
+
+    // Act
+    sut.select(variants, classes, enums);
+
+    // Assert
+    EXPECT_TRUE(variants[0].isTaggedUnion);
+    EXPECT_EQ(variants[0].estimatedSize, 40);
+}
+
+TEST(TaggedUnionsTest, OtherAlternatives)
+{
+    // Arrange
+    TaggedUnions sut{configWithArguments({"--compactVariants"})};
+
+    std::vector<Variant> variants(4);
+    variants[0].namespaces     = {"geo"};
+    variants[0].containedTypes = {Common::Type{"Circle"}, Common::Type{"Label"}};
+    variants[1].namespaces     = {"geo"};
+    variants[1].containedTypes = {Common::Type{"Square"}};
+    variants[2].namespaces     = {"geo"};
+    variants[2].containedTypes = {Common::Type{"Point"}, Common::Type{"Point"}};
+    variants[3].containedTypes = {Common::Type{"int"}};
+
+    // Act
+    sut.select(variants, model(), {});
+
+    // Assert
+    EXPECT_FALSE(variants[0].isTaggedUnion); // a string isn't trivially copyable
+    EXPECT_FALSE(variants[1].isTaggedUnion); // neither is a polymorphic base
+    EXPECT_FALSE(variants[2].isTaggedUnion); // alternatives must be distinct
+    EXPECT_FALSE(variants[3].isTaggedUnion); // and model classes
+}
+
+TEST(TaggedUnionsTest, ReservedAlternativeNames)
+{
+    // Arrange
+    TaggedUnions sut{configWithArguments({"--compactVariants"})};
+
+    auto classes = model();
+    classes.resize(7);
+    classes[5].name       = "Index";
+    classes[5].namespaces = {"geo"};
+    classes[5].body.emplace_back(Class::Variable{"value", Common::Type{"int"}});
+    classes[6].name = "index";
+    classes[6].body.emplace_back(Class::Variable{"value", Common::Type{"int"}});
+
+    std::vector<Variant> variants(3);
+    variants[0].containedTypes = {Common::Type{"Point"}, Common::Type{"geo::Index"}};
+    variants[1].containedTypes = {Common::Type{"Point"}, Common::Type{"index"}};
+    variants[2].containedTypes = {Common::Type{"Point"}};
+
+    // Act
+    sut.select(variants, classes, {});
+
+    // Assert
+    EXPECT_FALSE(variants[0].isTaggedUnion);
+    EXPECT_FALSE(variants[1].isTaggedUnion);
+    EXPECT_TRUE(variants[2].isTaggedUnion);
+}
+
+TEST(TaggedUnionsTest, UnknownMemberType)
+{
+    // Arrange
+    TaggedUnions sut{configWithArguments({"--compactVariants"})};
+
+    std::vector<Variant> variants(1);
+    variants[0].namespaces     = {"geo"};
+    variants[0].containedTypes = {Common::Type{"Circle"}};
+
+    // Act
+    sut.select(variants, model(), {});
+
+    // Assert
+    EXPECT_FALSE(variants[0].isTaggedUnion); // the enum Color isn't in the model
+}
+
+} // namespace Cpp::Variant
@@ -605,6 +605,39 @@ enum TimeUnit {
     // Assert Results
 }
 
+TEST(ParserTest, EnumWithValues)
+{
+    // Arrange
+    VisitorMock visitor;
+    Parser parser;
+
+    static constexpr auto puml =
+        R"(@startuml
+enum Level {
+  LOW = -1
+  MEDIUM
+  HIGH = 300
+}
+
+@enduml)";
+
+    Element e{{"Level"}, "", ' ', {}, {}, ElementType::Enum};
+    Enumerator en1{"LOW", "-1"};
+    Enumerator en2{"MEDIUM"};
+    Enumerator en3{"HIGH", "300"};
+
+    // Assert Calls
+    EXPECT_CALL(visitor, visit(e));
+    EXPECT_CALL(visitor, visit(en1));
+    EXPECT_CALL(visitor, visit(en2));
+    EXPECT_CALL(visitor, visit(en3));
+
+    // Act
+    act(parser, visitor, puml);
+
+    // Assert Results
+}
+
 TEST(ParserTest, Stereotypes)
 {
     // Arrange